@@ -2,13 +2,22 @@
 # define CUB3D_H
 
 # include <stdlib.h>
+# include <stddef.h>
 # include <unistd.h>
 # include <fcntl.h>
 # include <math.h>
+# include <pthread.h>
+# include <sys/mman.h>
 # include <mlx.h>
 
 # define WIN_WIDTH 1920
 # define WIN_HEIGHT 1080
+# define WIN_MIN 64
+# define WIN_MAX_W 7680
+# define WIN_MAX_H 4320
+# define FOV_MIN 20.0
+# define FOV_MAX 160.0
+# define PLANE_DEFAULT 0.66
 
 # define TEX_NO 0
 # define TEX_SO 1
@@ -16,6 +25,25 @@
 # define TEX_EA 3
 # define TEX_COUNT 4
 
+# define MAT_CODES 128
+# define DOOR_CELL 'D'
+# define DOOR_SPEED 0.04f
+# define DOOR_PASSABLE 0.9f
+# define MAT_MAX 64
+# define TEX_SLOTS 260
+
+# define LIGHT_MAX 64
+# define LIGHT_SAMPLES 8
+# define LIGHT_AMBIENT 0.35
+# define LIGHT_ONE 128
+# define LIGHT_EPSILON 0.001
+# define LIGHT_MAGIC "CUBL"
+# define LIGHT_VERSION 1
+# define LIGHT_HEADER 24
+
+# define FOG_LUT 1024
+# define FOG_OFF 1e30
+
 # define KEY_ESC 65307
 # define KEY_LEFT 65361
 # define KEY_RIGHT 65363
@@ -23,6 +51,98 @@
 # define KEY_A 97
 # define KEY_S 115
 # define KEY_D 100
+# define KEY_H 104
+# define KEY_E 101
+# define KEY_M 109
+
+# define VIEW_STRIP 64
+# define SPAN_EPS 1e-7
+# define REPROJ_MOVE 0.2
+# define REPROJ_TURN 0.1
+# define REPROJ_NEAR 0.05
+# define REPROJ_MAX_ERROR 64
+# define REPROJ_MEMCPY 16
+# define REPROJ_MIN_SHARE 4
+
+# define CHUNK_SHIFT 6
+# define CHUNK_SIZE 64
+# define CHUNK_MASK 63
+# define CHUNK_CELLS 4096
+# define CHUNK_VOID -1
+# define CHUNK_SOLID -2
+
+# define ENT_ACTIVE 1
+# define ENT_HIT_WALL 2
+# define ENT_HIT_AGENT 4
+# define ENT_MAX_RADIUS 0.49f
+# define ENT_EPSILON 0.0001f
+# define ENT_MAX_SUBSTEPS 64
+
+# define FLOW_INF 0x3FFFFFFF
+# define FLOW_SLOTS 4
+
+# define TRACE_OFF 0
+# define TRACE_RECORD 1
+# define TRACE_REPLAY 2
+
+# define FLAG_SWITCH 0
+# define FLAG_PATH 1
+# define FLAG_BATCH 2
+# define FLAG_RESOLUTION 3
+# define FLAG_FOV 4
+# define FLAG_REPROJECT 5
+# define TRACE_END 0x7F
+# define TRACE_MAGIC "CUBT"
+
+# define HIST_BUCKETS 1280
+# define LAT_QUEUE 64
+
+# define HEAT_MAX_CELLS 4194304
+
+# define MEM_WORD 0
+# define MEM_SSE2 1
+# define MEM_AVX2 2
+# define MEM_LEVELS 3
+# define MEM_STREAM_BYTES 4194304
+
+# define ARENA_BLOCK 65536
+# define READ_CHUNK 65536
+
+# define PMU_EVENTS 5
+# define PMU_STAGES 4
+# define PMU_BACKGROUND 0
+# define PMU_DDA 1
+# define PMU_TEXTURE 2
+# define PMU_PRESENT 3
+
+# define RELOAD_MAP 1
+# define RELOAD_TEX 2
+# define RELOAD_POLL_MS 100
+# define RELOAD_SETTLE_US 30000
+
+# define MINI_CELLS 32
+# define MINI_SCALE 8
+# define MINI_PX 256
+# define MINI_EDGE 6
+# define MINI_INSET 8
+# define MINI_DIRTY 64
+# define MINI_CONE 4
+# define MINI_VOID 0x000000
+# define MINI_FLOOR 0x262626
+# define MINI_WALL 0xA8A8A8
+# define MINI_BREAK 0x9A5A3C
+# define MINI_DOOR 0xC89640
+# define MINI_PLAYER 0xFF3C3C
+# define MINI_RAY 0xF0D050
+
+# define HUD_HISTORY 240
+# define HUD_PANEL_W 264
+# define HUD_SCALE 2
+# define HUD_STAGE_UPDATE 0
+# define HUD_STAGE_RAYS 1
+# define HUD_STAGE_HUD 2
+# define HUD_STAGE_PRESENT 3
+# define HUD_STAGES 4
 
 # define MOVE_SPEED 0.05
 # define ROT_SPEED 0.05
@@ -51,23 +171,181 @@ typedef struct s_img
 	int		height;
 }	t_img;
 
+typedef struct s_material
+{
+	char	code;
+	char	*face[TEX_COUNT];
+}	t_material;
+
+typedef struct s_light
+{
+	double	x;
+	double	y;
+	double	intensity;
+	double	radius;
+}	t_light;
+
 typedef struct s_config
 {
-	char	*texture[TEX_COUNT];
-	int		has_texture[TEX_COUNT];
-	t_color	floor;
-	t_color	ceiling;
-	int		floor_set;
-	int		ceiling_set;
+	char			*texture[TEX_COUNT];
+	int				has_texture[TEX_COUNT];
+	t_color			floor;
+	t_color			ceiling;
+	int				floor_set;
+	int				ceiling_set;
+	t_material		mat[MAT_MAX];
+	int				mat_count;
+	unsigned char	mat_index[MAT_CODES];
+	unsigned char	breakable[MAT_CODES];
+	t_light			light[LIGHT_MAX];
+	int				light_count;
+	double			fog_dist;
+	t_color			fog;
+	int				fog_set;
 }	t_config;
 
+typedef struct s_tex_table
+{
+	const char		*path[TEX_SLOTS];
+	int				count;
+	unsigned short	face[MAT_CODES * TEX_COUNT];
+}	t_tex_table;
+
+typedef struct s_lightmap
+{
+	long			*keys;
+	unsigned char	*samples;
+	int				count;
+	int				cap;
+	unsigned long	hash;
+	long			bake_us;
+	int				cached;
+}	t_lightmap;
+
+typedef struct s_fog
+{
+	double			limit;
+	double			scale;
+	unsigned int	color;
+	unsigned short	weight[FOG_LUT];
+}	t_fog;
+
+typedef struct s_camera
+{
+	double	*table;
+	int		cols;
+}	t_camera;
+
+typedef struct s_door
+{
+	long	key;
+	float	open;
+	float	speed;
+}	t_door;
+
+typedef struct s_doors
+{
+	t_door	*items;
+	int		count;
+	int		cap;
+	long	*moving;
+	int		moving_count;
+	int		moving_cap;
+}	t_doors;
+
 typedef struct s_map
 {
-	char	**grid;
+	char	**chunks;
+	int		chunk_cols;
+	int		chunk_rows;
 	int		width;
 	int		height;
+	char	*void_chunk;
+	char	*solid_chunk;
+	char	*store;
+	size_t	store_size;
+	int		shared;
+	t_doors	doors;
 }	t_map;
 
+typedef struct s_arena_block
+{
+	struct s_arena_block	*next;
+	size_t					cap;
+	size_t					used;
+	char					data[];
+}	t_arena_block;
+
+typedef struct s_arena
+{
+	t_arena_block	*head;
+	t_arena_block	*cur;
+}	t_arena;
+
+typedef struct s_reader
+{
+	int		fd;
+	int		pos;
+	int		len;
+	char	*line;
+	size_t	line_cap;
+	char	buf[READ_CHUNK];
+}	t_reader;
+
+typedef struct s_cell_edit
+{
+	int		x;
+	int		y;
+	char	c;
+}	t_cell_edit;
+
+typedef struct s_map_patch
+{
+	t_cell_edit	*cells;
+	long		count;
+	long		cap;
+	long		rows_checked;
+	int			reshaped;
+}	t_map_patch;
+
+typedef struct s_map_builder
+{
+	char			*band[CHUNK_SIZE];
+	int				band_len[CHUNK_SIZE];
+	int				band_count;
+	int				band_first;
+	char			*carry;
+	int				carry_len;
+	int				carry_cap;
+	t_arena			arena;
+	int				rows;
+	int				width;
+	int				has_player;
+	long			*slots;
+	long			slot_count;
+	long			slot_cap;
+	int				*band_cols;
+	int				band_total;
+	int				band_cap;
+	char			*scratch;
+	int				scratch_cols;
+	long			*doors;
+	long			door_count;
+	long			door_cap;
+	long			file_chunks;
+	int				fd;
+	const t_map		*prev;
+	t_map_patch		*patch;
+	int				recent;
+	const t_config	*cfg;
+}	t_map_builder;
+
+typedef struct s_row_window
+{
+	const char	*row[3];
+	int			len[3];
+}	t_row_window;
+
 typedef struct s_player
 {
 	double	x;
@@ -78,6 +356,33 @@ typedef struct s_player
 	double	plane_y;
 }	t_player;
 
+typedef struct s_reproj_col
+{
+	double	hit_x;
+	double	hit_y;
+	int		height;
+	int		valid;
+}	t_reproj_col;
+
+typedef struct s_reproj
+{
+	t_img			prev;
+	t_reproj_col	*cols;
+	t_reproj_col	*next;
+	int				*src;
+	int				*runs;
+	double			*depth;
+	int				run_count;
+	int				keep[2];
+	int				valid;
+	int				capture;
+	t_player		cam;
+	long			frames;
+	long			full;
+	long			columns;
+	long			copied;
+}	t_reproj;
+
 typedef struct s_input
 {
 	int	forward;
@@ -86,21 +391,357 @@ typedef struct s_input
 	int	right;
 	int	turn_left;
 	int	turn_right;
+	int	use;
 }	t_input;
 
+typedef void	(*t_job)(void *ctx, int begin, int end);
+typedef void	(*t_copy_fn)(void *dst, const void *src, size_t n);
+typedef void	(*t_fill32_fn)(void *dst, unsigned int value, size_t count);
+
+typedef unsigned int	t_u32u __attribute__((aligned(1), may_alias));
+typedef unsigned long	t_u64u __attribute__((aligned(1), may_alias));
+
+typedef struct s_memops
+{
+	const char	*name;
+	t_copy_fn	copy;
+	t_fill32_fn	fill32;
+}	t_memops;
+
+typedef struct s_pool
+{
+	pthread_t		*threads;
+	int				size;
+	int				spawned;
+	pthread_mutex_t	lock;
+	pthread_cond_t	wake;
+	pthread_cond_t	done;
+	unsigned long	generation;
+	int				stop;
+	int				busy;
+	t_job			job;
+	void			*ctx;
+	int				count;
+	int				grain;
+	int				next;
+	int				pending;
+	long			work_us;
+	int				timed;
+}	t_pool;
+
+typedef struct s_entity_desc
+{
+	float	x;
+	float	y;
+	float	vx;
+	float	vy;
+	float	radius;
+}	t_entity_desc;
+
+typedef struct s_entities
+{
+	float			*x;
+	float			*y;
+	float			*vx;
+	float			*vy;
+	float			*radius;
+	unsigned char	*state;
+	float			*next_x;
+	float			*next_y;
+	int				*bucket_start;
+	unsigned int	*bucket_of;
+	int				*sorted;
+	unsigned int	bucket_mask;
+	float			cell_size;
+	float			max_radius;
+	int				count;
+	int				capacity;
+}	t_entities;
+
+typedef struct s_entity_tick
+{
+	t_entities	*ents;
+	const t_map	*map;
+	float		dt;
+}	t_entity_tick;
+
+typedef struct s_flow
+{
+	const t_map	*map;
+	int			*dist;
+	int			width;
+	int			height;
+	int			radius;
+	int			*heap_key;
+	long		*heap_cell;
+	int			heap_len;
+	int			heap_cap;
+	long		*stack;
+	int			*stack_dist;
+	int			stack_len;
+	int			stack_cap;
+	long		touched;
+}	t_flow;
+
+typedef struct s_los_query
+{
+	double	from_x;
+	double	from_y;
+	double	to_x;
+	double	to_y;
+	int		visible;
+	double	hit_dist;
+}	t_los_query;
+
+typedef struct s_los
+{
+	t_pool			*pool;
+	const t_map		*map;
+	t_los_query		*queries;
+	unsigned int	*keys;
+	unsigned int	*tmp_keys;
+	int				*order;
+	int				*tmp_order;
+	int				capacity;
+}	t_los;
+
+typedef struct s_options
+{
+	const char	*map_path;
+	const char	*record_path;
+	const char	*replay_path;
+	const char	*batch_views;
+	const char	*batch_out;
+	const char	*heatmap_path;
+	const char	*pmu_path;
+	const char	*light_cache;
+	int			headless;
+	int			watch;
+	int			width;
+	int			height;
+	double		fov;
+	int			no_spans;
+	int			reproject;
+}	t_options;
+
+typedef struct s_flag
+{
+	const char	*name;
+	int			kind;
+	size_t		field;
+}	t_flag;
+
+typedef struct s_trace
+{
+	int				mode;
+	const char		*path;
+	unsigned char	*data;
+	size_t			len;
+	size_t			cap;
+	size_t			pos;
+	long			last_tick;
+	long			last_usec;
+	long			next_tick;
+	int				next_id;
+	int				next_pressed;
+}	t_trace;
+
+typedef struct s_hist
+{
+	long	buckets[HIST_BUCKETS];
+	long	count;
+	long	sum;
+	long	max;
+}	t_hist;
+
+typedef struct s_latency
+{
+	long	pending[LAT_QUEUE];
+	int		pending_count;
+	long	applied[LAT_QUEUE];
+	int		applied_count;
+	t_hist	hist;
+}	t_latency;
+
+typedef struct s_hud
+{
+	int		visible;
+	float	frame_ms[HUD_HISTORY];
+	int		head;
+	int		filled;
+	long	last_usec;
+	long	stage_us[HUD_STAGES];
+	long	dda_steps;
+	long	rays;
+	long	work_mark;
+	long	wall_mark;
+	double	util;
+}	t_hud;
+
+typedef struct s_minimap
+{
+	t_img	img;
+	int		visible;
+	int		valid;
+	int		origin_x;
+	int		origin_y;
+	int		player_x;
+	int		player_y;
+	int		dirty[MINI_DIRTY][2];
+	int		dirty_count;
+	long	repaints;
+	long	cells_painted;
+}	t_minimap;
+
+typedef struct s_batch
+{
+	struct s_game	*game;
+	t_player		*views;
+	int				count;
+	const char		*out_dir;
+	t_img			*frames[2];
+	t_img			*render;
+	int				slots;
+	int				first;
+	pthread_t		writer;
+	pthread_mutex_t	lock;
+	pthread_cond_t	cond;
+	t_img			*pending;
+	int				pending_first;
+	int				pending_count;
+	int				stop;
+	int				failed;
+	unsigned char	*rgb;
+}	t_batch;
+
+typedef struct s_gen
+{
+	int				width;
+	int				height;
+	int				fd;
+	int				player_x;
+	int				player_y;
+	unsigned int	seed;
+	unsigned int	rng;
+	char			*row;
+	int				cells;
+	int				*set;
+	int				*parent;
+	int				*remap;
+	int				*count;
+	char			*flags;
+	char			*right;
+	char			*down;
+}	t_gen;
+
+typedef void	(*t_gen_row)(t_gen *gen, int y);
+
+typedef struct s_dda_stats
+{
+	unsigned int	*heat;
+	int				heat_w;
+	int				heat_h;
+	int				heat_shift;
+	long			rays;
+	long			steps;
+	long			max_steps;
+	long			escapes;
+	long			fogged;
+	long			frames;
+	long			total_rays;
+	long			total_steps;
+	long			total_escapes;
+	long			total_fogged;
+	long			worst_frame_max;
+	double			worst_frame_mean;
+}	t_dda_stats;
+
+typedef struct s_view
+{
+	t_player	cam;
+	t_img		*target;
+	long		steps;
+	t_dda_stats	*stats;
+}	t_view;
+
+typedef struct s_view_run
+{
+	struct s_game	*game;
+	t_view			*views;
+	int				*first_strip;
+}	t_view_run;
+
+typedef struct s_reload
+{
+	struct s_game	*game;
+	struct s_game	*next;
+	int				fd;
+	int				wd[TEX_SLOTS + 1];
+	const char		*name[TEX_SLOTS + 1];
+	unsigned char	dirty[TEX_SLOTS + 1];
+	int				slots;
+	pthread_t		thread;
+	pthread_mutex_t	lock;
+	pthread_cond_t	idle;
+	int				ready;
+	int				stop;
+	int				started;
+	t_map_patch		patch;
+	t_tex_table		table;
+	int				reuse[TEX_SLOTS];
+	t_img			tex[TEX_SLOTS];
+	int				decoded;
+	long			stage_us;
+}	t_reload;
+
 typedef struct s_game
 {
 	void		*mlx;
 	void		*win;
 	t_img		frame;
-	t_img		texture[TEX_COUNT];
+	t_img		*tex;
+	t_tex_table	textures;
+	t_img		*face[MAT_CODES * TEX_COUNT];
+	t_lightmap	light;
+	t_fog		fog;
+	t_camera	camera;
 	t_config	config;
 	t_map		map;
 	t_player	player;
 	t_input		input;
+	t_entities	entities;
+	t_pool		pool;
+	t_options	opts;
+	t_trace		trace;
+	t_latency	latency;
+	t_hud		hud;
+	t_minimap	minimap;
+	t_reproj	reproj;
+	t_dda_stats	*dda;
+	struct s_pmu	*pmu;
+	struct s_reload	*reload;
+	t_flow		*flows[FLOW_SLOTS];
+	int			flow_count;
+	long		tick;
 	int			running;
 }	t_game;
 
+typedef struct s_session
+{
+	t_game	game;
+	int		id;
+	int		done;
+	long	frames;
+}	t_session;
+
+typedef struct s_runtime
+{
+	t_game		*host;
+	t_session	*sessions;
+	int			count;
+	int			active;
+}	t_runtime;
+
 typedef struct s_ray
 {
 	double	dir_x;
@@ -114,46 +755,243 @@ typedef struct s_ray
 	double	step_x;
 	double	step_y;
 	int		side;
+	int		cell;
 	double	perp_dist;
+	double	org_x;
+	double	org_y;
+	double	shift;
+	double	limit;
 }	t_ray;
 
+typedef struct s_pmu
+{
+	int			fd[PMU_EVENTS];
+	int			open_count;
+	long long	mark[PMU_EVENTS];
+	long long	frame[PMU_STAGES][PMU_EVENTS];
+	long long	total[PMU_STAGES][PMU_EVENTS];
+	long		frames;
+	int			csv_fd;
+	t_ray		*rays;
+	int			*steps;
+	int			ray_cap;
+}	t_pmu;
+
 typedef struct s_column
 {
-	int	x;
-	int	start;
-	int	end;
-	int	tex_x;
-	int	line_height;
+	int				x;
+	int				start;
+	int				end;
+	int				tex_x;
+	int				line_height;
+	int				light;
+	int				fog;
+	unsigned int	fog_rb;
+	unsigned int	fog_g;
 }	t_column;
 
+typedef struct s_span
+{
+	t_ray	*rays;
+	int		*steps;
+	int		x0;
+	int		x1;
+}	t_span;
+
 /* ----------------------------- parsing ---------------------------------- */
 int		parse_scene(t_game *game, const char *path);
+int		parse_scene_into(t_game *game, const char *path,
+			t_map_builder *builder);
 void	free_config(t_config *cfg);
 void	free_map(t_map *map);
 
 /* ------------------------------ game ------------------------------------ */
+int		parse_options(t_options *opts, int argc, char **argv);
+int		parse_view_flag(t_options *opts, int kind, const char *value);
 int		init_game(t_game *game);
+int		init_headless(t_game *game);
+int		load_texture_file(t_img *tex, const char *path);
+void	release_image(t_game *game, t_img *img);
+void	texture_table_build(t_tex_table *table, const t_config *cfg);
+void	texture_faces_bind(t_game *game);
+int		init_textures(t_game *game);
+void	destroy_textures(t_game *game);
 void	destroy_game(t_game *game);
 int		game_loop(void *param);
 int		handle_close(void *param);
 int		handle_key_press(int keycode, void *param);
 int		handle_key_release(int keycode, void *param);
+int		set_movement_flag(t_input *input, int keycode, int value);
 void	update_game_state(t_game *game);
 
+char	map_cell(const t_map *map, int x, int y);
+int		map_is_solid(const t_map *map, int x, int y);
+int		map_chunk_owned(const t_map *map, const char *chunk);
+void	map_set_cell(t_map *map, int x, int y, char c);
+long	map_cell_key(const t_map *map, int x, int y);
+t_door	*map_door(const t_map *map, long key);
+void	map_door_set(t_map *map, int x, int y, int present);
+int		map_door_blocks(const t_map *map, int x, int y);
+void	door_toggle(t_map *map, t_door *door);
+void	doors_tick(t_game *game);
+void	map_doors_clone(t_doors *dst, const t_doors *src);
+int		world_interact(t_game *game);
+int		world_lock(t_game *game);
+void	world_unlock(t_game *game);
+int		world_track_flow(t_game *game, t_flow *flow);
+void	world_cell_changed(t_game *game, int x, int y);
+
+/* ----------------------------- entities --------------------------------- */
+int		entities_spawn(t_entities *ents, t_entity_desc *desc);
+void	free_entities(t_entities *ents);
+void	entities_tick(t_entities *ents, const t_map *map, t_pool *pool,
+			float dt);
+void	entities_move_range(void *ctx, int begin, int end);
+void	entity_sweep(t_entities *ents, const t_map *map, int i, float dt);
+void	entities_build_hash(t_entities *ents);
+unsigned int	entity_hash_cell(int cx, int cy, unsigned int mask);
+void	entities_separate_range(void *ctx, int begin, int end);
+
+/* ---------------------------- navigation -------------------------------- */
+int		flow_init(t_flow *flow, const t_map *map, int radius);
+void	free_flow(t_flow *flow);
+int		flow_passable(t_flow *flow, long cell);
+void	flow_propagate(t_flow *flow);
+void	flow_heap_push(t_flow *flow, int key, long cell);
+int		flow_heap_pop(t_flow *flow, int *key, long *cell);
+void	flow_reseed(t_flow *flow, long cell);
+void	flow_invalidate(t_flow *flow, long cell);
+int		flow_add_target(t_flow *flow, int x, int y);
+int		flow_remove_target(t_flow *flow, int x, int y);
+int		flow_move_target(t_flow *flow, int *from, int x, int y);
+void	flow_cell_changed(t_flow *flow, int x, int y);
+int		flow_distance(const t_flow *flow, int x, int y);
+int		flow_direction(t_flow *flow, int x, int y, int *step);
+void	los_run(t_los *los, const t_map *map, t_los_query *queries, int count);
+void	los_sort_queries(t_los *los, const t_los_query *queries, int count);
+void	free_los(t_los *los);
+
+/* -------------------------- replay / perf ------------------------------- */
+int		trace_start_record(t_game *game, const char *path);
+void	trace_record_key(t_game *game, int keycode, int pressed);
+int		trace_finish(t_game *game);
+int		trace_load(t_game *game, const char *path);
+int		trace_apply(t_game *game);
+void	trace_put(t_trace *trace, const void *src, size_t len);
+void	trace_put_varint(t_trace *trace, unsigned long value);
+int		trace_get_varint(t_trace *trace, unsigned long *value);
+int		trace_key_id(int keycode);
+int		trace_keycode(int id);
+int		run_headless_replay(t_game *game);
+int		batch_load_views(t_batch *batch, const char *path);
+int		batch_parse_view(const t_map *map, t_player *view, char *line);
+int		batch_writer_start(t_batch *batch);
+t_img	*batch_alloc_frames(int count, int width, int height);
+void	batch_free_frames(t_img *frames, int count);
+int		batch_write_ppm(t_batch *batch, t_img *img, int index);
+void	batch_hand_off(t_batch *batch, t_img *frames, int first, int count);
+int		batch_writer_stop(t_batch *batch);
+int		run_render_batch(t_game *game);
+long	now_usec(void);
+void	hist_add(t_hist *hist, long value);
+long	hist_percentile(const t_hist *hist, double pct);
+void	hist_print_json(const t_hist *hist, const char *name, int last);
+void	print_bench_report(t_game *game, t_hist *frames, long total_us);
+void	latency_input(t_latency *lat, long usec);
+void	latency_consume(t_latency *lat);
+void	latency_present(t_latency *lat, long usec);
+void	latency_print(const t_latency *lat);
+int		dda_stats_init(t_dda_stats *stats, const t_map *map);
+void	dda_stats_free(t_dda_stats *stats);
+int		dda_step_counted(const t_map *map, t_ray *ray, t_dda_stats *stats);
+void	dda_stats_frame(t_dda_stats *stats);
+unsigned int	dda_heat_max(const t_dda_stats *stats);
+void	dda_stats_print_json(const t_dda_stats *stats, int last);
+int		init_dda_stats(t_game *game);
+void	finish_dda_stats(t_game *game);
+int		dda_heatmap_write(const t_dda_stats *stats, const t_map *map,
+			const char *path);
+int		pmu_open(t_pmu *pmu);
+void	pmu_close(t_pmu *pmu);
+void	pmu_mark(t_pmu *pmu);
+void	pmu_stage(t_pmu *pmu, int stage);
+void	pmu_end_frame(t_pmu *pmu);
+void	pmu_render(t_game *game, t_view *view);
+void	pmu_print_json(const t_pmu *pmu, int last);
+int		init_pmu(t_game *game);
+void	finish_pmu(t_game *game);
+void	hud_frame(t_game *game, long now);
+void	hud_draw(t_game *game);
+void	hud_text(t_img *img, int x, int y, const char *text);
+void	hud_shade(t_img *img, int x0, int y0, int x1, int y1);
+void	hud_graph(t_hud *hud, t_img *img, int x, int y);
+void	minimap_touch(t_game *game, int x, int y);
+void	minimap_invalidate(t_game *game);
+void	minimap_draw(t_game *game);
+void	minimap_paint_cell(t_game *game, int x, int y);
+void	minimap_paint_all(t_game *game);
+void	minimap_paint_player(t_game *game);
+void	minimap_blit(t_game *game, t_img *dst, int x0, int y0);
+void	free_minimap(t_minimap *mm);
+
 /* ------------------------------ render ---------------------------------- */
 void	render_frame(t_game *game);
+void	render_view(t_game *game, t_view *view);
+void	render_view_span(t_game *game, t_view *view, int x0, int x1);
+void	render_wall(t_game *game, t_view *view, int x, t_ray *ray);
+void	span_cast(t_game *game, t_view *view, t_span *span);
+int		span_region(const t_map *map, const t_ray *a, const t_ray *b,
+			long budget);
+int		span_hit(const t_ray *hit, t_ray *ray);
+void	render_views(t_game *game, t_view *views, int count);
+int		view_target_init(t_game *game, t_img *img, int width, int height);
+void	camera_set_plane(t_player *cam, double plane_len);
+double	view_plane_len(const t_options *opts);
+void	view_setup(t_game *game);
+double	view_camera_x(const t_game *game, int width, int x);
+void	free_camera(t_camera *camera);
+void	reproj_render(t_game *game, t_view *view);
+int		reproj_frame(t_game *game, t_view *view);
+void	reproj_store(t_game *game, int x, const t_ray *ray, int height);
+void	reproj_copy_rows(void *ctx, int begin, int end);
+void	reproj_holes(void *ctx, int begin, int end);
+void	reproj_invalidate(t_game *game);
+void	free_reproj(t_game *game);
 void	clear_frame(t_img *img, int color);
 void	draw_pixel(t_img *img, int x, int y, int color);
 int		get_color_from_tex(t_img *tex, int x, int y);
 int		rgb_to_int(t_color color);
-void	render_background(t_game *game);
-void	ray_init(t_game *game, t_ray *ray, int x);
-void	ray_set_step(t_game *game, t_ray *ray);
-int		ray_step_until_hit(t_game *game, t_ray *ray);
+void	render_background(t_game *game, t_img *img, int x0, int x1);
+int		background_color(t_game *game, const t_img *img, int y, int half);
+void	ray_prepare(t_ray *ray, double origin_x, double origin_y);
+void	ray_init(t_view *view, t_ray *ray, double camera_x);
+int		ray_advance_cell(const t_map *map, t_ray *ray);
+int		ray_step_until_hit(const t_map *map, t_ray *ray, t_dda_stats *stats);
+int		ray_finish_hit(t_ray *ray, int steps);
 int		select_texture_index(t_game *game, t_ray *ray);
-void	compute_wall_limits(int line_height, int *start, int *end);
-int		compute_tex_x(t_game *game, t_ray *ray, t_img *tex);
-void	draw_texture_column(t_game *game, t_ray *ray, t_img *tex, t_column *col);
+int		ray_door_hit(const t_map *map, t_ray *ray);
+int		door_tex_x(const t_ray *ray, int tex_x, int width);
+void	compute_wall_limits(int line_height, int height, int *start, int *end);
+int		compute_tex_x(t_view *view, t_ray *ray, t_img *tex);
+void	draw_texture_column(t_view *view, t_ray *ray, t_img *tex,
+			t_column *col);
+int		xpm_decode(t_img *img, char *data);
+char	*xpm_next_string(char *cursor, char **end);
+char	*xpm_read_colors(char *cursor, const int *hdr, int *table);
+void	lightmap_build(t_game *game);
+void	lightmap_collect(t_game *game);
+int		lightmap_faces(const t_game *game, int x, int y, long *keys);
+void	lightmap_patch(t_game *game, int x, int y);
+void	lightmap_bake_range(void *ctx, int begin, int end);
+int		lightmap_level(const t_game *game, const t_ray *ray, int face);
+unsigned long	lightmap_hash(const t_game *game);
+int		lightmap_cache_load(t_lightmap *lm, const char *path);
+int		lightmap_cache_save(const t_lightmap *lm, const char *path);
+void	free_lightmap(t_lightmap *lm);
+void	fog_build(t_game *game);
+int		fog_weight(const t_fog *fog, double dist);
+unsigned int	fog_apply(const t_fog *fog, unsigned int color, int weight);
+void	fog_column(const t_fog *fog, t_column *col, double dist);
 
 /* ------------------------------ utils ----------------------------------- */
 int		ft_strlen(const char *s);
@@ -165,23 +1003,100 @@ int		ft_is_digit(int c);
 int		ft_atoi_strict(const char *str, int *out);
 void	*ft_calloc(size_t count, size_t size);
 void	*safe_malloc(size_t size);
+long	malloc_calls(int add);
 void	ft_bzero(void *ptr, size_t size);
+void	*ft_memset(void *ptr, int c, size_t size);
 void	*ft_memcpy(void *dst, const void *src, size_t n);
+void	ft_fill32(void *dst, unsigned int value, size_t count);
+const t_memops	*mem_ops(void);
+const t_memops	*mem_ops_level(int level);
+void	mem_word_copy(void *dst, const void *src, size_t n);
+void	mem_word_fill32(void *dst, unsigned int value, size_t count);
+void	mem_sse2_copy(void *dst, const void *src, size_t n);
+void	mem_sse2_fill32(void *dst, unsigned int value, size_t count);
+void	mem_avx2_copy(void *dst, const void *src, size_t n);
+void	mem_avx2_fill32(void *dst, unsigned int value, size_t count);
+# if !defined(__x86_64__) && !defined(__i386__)
+#  define mem_sse2_copy mem_word_copy
+#  define mem_sse2_fill32 mem_word_fill32
+#  define mem_avx2_copy mem_word_copy
+#  define mem_avx2_fill32 mem_word_fill32
+# endif
 int		print_error(const char *msg);
-int		read_line(int fd, char **line);
-char	**arr_push(char ***arr, int *len, char *line);
-void	free_str_array(char **arr);
+int		read_line(t_reader *rd, char **line);
+void	*arena_alloc(t_arena *arena, size_t size);
+char	*arena_strndup(t_arena *arena, const char *s, size_t n);
+void	arena_reset(t_arena *arena);
+void	arena_free(t_arena *arena);
+char	*read_file(const char *path, size_t *out_len);
+int		write_all(int fd, const void *data, size_t len);
+int		write_file(const char *path, const void *data, size_t len);
 char	*trim_spaces(char *str);
-int		is_map_line(const char *line);
+int		is_map_line(const char *line, const t_config *cfg);
 int		is_all_space(const char *line);
+int		pool_init(t_pool *pool, int threads);
+void	pool_run(t_pool *pool, t_job job, void *ctx, int count);
+void	pool_destroy(t_pool *pool);
+
+/* ------------------------------ reload ---------------------------------- */
+int		init_reload(t_game *game);
+void	finish_reload(t_game *game);
+void	reload_poll(t_game *game);
+int		reload_watch(t_reload *rl, t_game *game);
+int		reload_events(t_reload *rl);
+int		reload_stage(t_reload *rl);
+void	reload_apply(t_game *game, t_reload *rl, int staged);
+void	reload_discard(t_reload *rl);
+void	reload_bake(t_reload *rl);
+
+/* ----------------------------- sessions --------------------------------- */
+int		session_init(t_session *session, t_game *host, int id);
+void	session_step(t_session *session);
+void	session_destroy(t_session *session);
+int		runtime_init(t_runtime *rt, t_game *host, int count);
+int		runtime_tick(t_runtime *rt);
+void	runtime_destroy(t_runtime *rt);
+
+/* ------------------------------ cubgen ---------------------------------- */
+char	*gen_load_header(const char *path, size_t *len);
+unsigned int	gen_hash(unsigned int seed, int x, int y);
+unsigned int	gen_rand(t_gen *gen);
+int		gen_maze_init(t_gen *gen);
+void	gen_maze_free(t_gen *gen);
+void	gen_maze_step(t_gen *gen, int last);
+void	gen_maze_relabel(t_gen *gen);
+void	gen_maze_row(t_gen *gen, int y);
+void	gen_arena_row(t_gen *gen, int y);
+void	gen_corridor_row(t_gen *gen, int y);
+void	gen_cave_row(t_gen *gen, int y);
 
 /* --------------------------- parsing utils ------------------------------ */
 int		parse_texture_line(t_config *cfg, const char *line);
 int		parse_color_line(t_config *cfg, const char *line);
-int		finalize_map(t_map *map, char **lines, int count);
-int		validate_scene(t_game *game);
-int		setup_player(t_game *game);
+int		parse_material_line(t_config *cfg, char *line);
+int		parse_break_line(t_config *cfg, char *line);
+int		parse_light_line(t_config *cfg, char *line);
+int		parse_fog_line(t_config *cfg, char *line);
+int		parse_rgb_values(const char *line, int *idx, t_color *color);
+void	map_builder_init(t_map_builder *b);
+const char	*map_builder_row(t_map_builder *b, int y, int *len);
+int		map_builder_push(t_game *game, t_map_builder *b, char *line);
+int		map_builder_finish(t_game *game, t_map_builder *b);
+int		map_builder_store_band(t_map_builder *b);
+void	map_builder_chunk_doors(t_map_builder *b, int col);
+void	map_builder_link_doors(t_map_builder *b, t_map *map);
+int		map_builder_build(t_map_builder *b, t_map *map);
+void	map_builder_discard(t_map_builder *b);
+int		map_diff_check(t_map_builder *b, const char *line, int len);
+int		map_diff_finish(t_game *game, t_map_builder *b);
+int		validate_map_row(t_map_builder *b, int y, const char *below,
+			int below_len);
+int		validate_scene(t_game *game, const t_map_builder *b);
+int		claim_player(t_game *game, char *row, int y, int *has_player);
+void	set_orientation(t_player *player, char dir);
 int		scene_config_ready(t_config *cfg);
-int		scene_process_entry(t_game *game, char *raw);
+int		scene_process_entry(t_game *game, char *line);
+int		scene_wall_code(const t_config *cfg, char c);
+int		scene_header_key(const char *line);
 
 #endif
@@ -0,0 +1,74 @@
+#include "cub3d.h"
+#include <stdio.h>
+
+t_img	*batch_alloc_frames(int count, int width, int height)
+{
+	t_img	*frames;
+	int		i;
+
+	frames = ft_calloc(count, sizeof(t_img));
+	i = 0;
+	while (i < count)
+	{
+		frames[i].width = width;
+		frames[i].height = height;
+		frames[i].bpp = 32;
+		frames[i].line_len = width * 4;
+		frames[i].addr = safe_malloc((size_t)width * height * 4);
+		i++;
+	}
+	return (frames);
+}
+
+void	batch_free_frames(t_img *frames, int count)
+{
+	int	i;
+
+	i = 0;
+	while (frames && i < count)
+		free(frames[i++].addr);
+	free(frames);
+}
+
+static void	pack_rgb(unsigned char *dst, t_img *img)
+{
+	unsigned int	*src;
+	int				x;
+	int				y;
+
+	y = 0;
+	while (y < img->height)
+	{
+		src = (unsigned int *)(img->addr + (long)y * img->line_len);
+		x = 0;
+		while (x < img->width)
+		{
+			dst[0] = (src[x] >> 16) & 0xFF;
+			dst[1] = (src[x] >> 8) & 0xFF;
+			dst[2] = src[x] & 0xFF;
+			dst += 3;
+			x++;
+		}
+		y++;
+	}
+}
+
+int	batch_write_ppm(t_batch *batch, t_img *img, int index)
+{
+	char	path[4096];
+	char	head[64];
+	int		fd;
+	int		n;
+	int		status;
+
+	pack_rgb(batch->rgb, img);
+	snprintf(path, sizeof(path), "%s/view_%06d.ppm", batch->out_dir, index);
+	n = snprintf(head, sizeof(head), "P6\n%d %d\n255\n", img->width,
+			img->height);
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return (1);
+	status = write_all(fd, head, n) || write_all(fd, batch->rgb,
+			(size_t)img->width * img->height * 3);
+	return (close(fd) || status);
+}
@@ -0,0 +1,42 @@
+#include "cub3d.h"
+
+static int	parse_number(char *str, char **end, double *out)
+{
+	*out = strtod(str, end);
+	return (*end == str || !isfinite(*out));
+}
+
+static int	parse_direction(t_player *view, char *token)
+{
+	double	rad;
+
+	if ((token[0] == 'N' || token[0] == 'S' || token[0] == 'E'
+			|| token[0] == 'W') && (token[1] == '\0' || ft_is_space(token[1])))
+		set_orientation(view, *token++);
+	else if (parse_number(token, &token, &rad))
+		return (1);
+	else
+	{
+		rad *= M_PI / 180.0;
+		view->dir_x = cos(rad);
+		view->dir_y = -sin(rad);
+		camera_set_plane(view, PLANE_DEFAULT);
+	}
+	while (ft_is_space(*token))
+		token++;
+	return (*token != '\0');
+}
+
+int	batch_parse_view(const t_map *map, t_player *view, char *line)
+{
+	if (parse_number(line, &line, &view->x)
+		|| parse_number(line, &line, &view->y))
+		return (1);
+	while (ft_is_space(*line))
+		line++;
+	if (parse_direction(view, line))
+		return (1);
+	return (!(view->x >= 0.0 && view->x < map->width
+			&& view->y >= 0.0 && view->y < map->height)
+		|| map_is_solid(map, (int)view->x, (int)view->y));
+}
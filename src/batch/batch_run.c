@@ -0,0 +1,87 @@
+#include "cub3d.h"
+#include <stdio.h>
+#include <sys/stat.h>
+
+static void	render_job(void *ctx, int begin, int end)
+{
+	t_batch	*batch;
+	t_view	view;
+
+	batch = (t_batch *)ctx;
+	while (begin < end)
+	{
+		view.cam = batch->views[batch->first + begin];
+		if (batch->game->opts.fov > 0.0)
+			camera_set_plane(&view.cam, view_plane_len(&batch->game->opts));
+		view.target = &batch->render[begin];
+		view.steps = 0;
+		view.stats = NULL;
+		render_view(batch->game, &view);
+		begin++;
+	}
+}
+
+static void	render_all(t_batch *batch, t_pool *pool)
+{
+	int	set;
+	int	count;
+
+	set = 0;
+	batch->first = 0;
+	while (batch->first < batch->count
+		&& !__atomic_load_n(&batch->failed, __ATOMIC_ACQUIRE))
+	{
+		count = batch->count - batch->first;
+		if (count > batch->slots)
+			count = batch->slots;
+		batch->render = batch->frames[set];
+		pool_run(pool, render_job, batch, count);
+		batch_hand_off(batch, batch->render, batch->first, count);
+		batch->first += count;
+		set ^= 1;
+	}
+}
+
+static int	render_batch(t_batch *batch, t_pool *pool)
+{
+	long	elapsed;
+
+	if (batch_writer_start(batch))
+		return (1);
+	elapsed = now_usec();
+	render_all(batch, pool);
+	if (batch_writer_stop(batch))
+		return (print_error("Failed to write batch output"));
+	elapsed = now_usec() - elapsed;
+	if (elapsed < 1)
+		elapsed = 1;
+	printf("rendered %d views in %.1f ms (%.1f views/s, %d threads)\n",
+		batch->count, elapsed / 1000.0, batch->count * 1e6 / elapsed,
+		pool->size);
+	return (0);
+}
+
+int	run_render_batch(t_game *game)
+{
+	t_batch	batch;
+	int		status;
+
+	ft_bzero(&batch, sizeof(t_batch));
+	batch.game = game;
+	batch.out_dir = game->opts.batch_out;
+	status = batch_load_views(&batch, game->opts.batch_views);
+	if (!status)
+	{
+		mkdir(batch.out_dir, 0755);
+		batch.slots = game->pool.size * 2;
+		batch.frames[0] = batch_alloc_frames(batch.slots, game->opts.width,
+				game->opts.height);
+		batch.frames[1] = batch_alloc_frames(batch.slots, game->opts.width,
+				game->opts.height);
+		status = render_batch(&batch, &game->pool);
+	}
+	batch_free_frames(batch.frames[0], batch.slots);
+	batch_free_frames(batch.frames[1], batch.slots);
+	free(batch.views);
+	return (status);
+}
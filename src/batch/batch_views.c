@@ -0,0 +1,63 @@
+#include "cub3d.h"
+
+static int	add_view(t_batch *batch, char *line, int *cap)
+{
+	t_player	*grown;
+
+	while (ft_is_space(*line))
+		line++;
+	if (*line == '\0' || *line == '#')
+		return (0);
+	if (batch->count == *cap)
+	{
+		*cap = *cap * 2 + 64;
+		grown = safe_malloc(sizeof(t_player) * *cap);
+		if (batch->views)
+			ft_memcpy(grown, batch->views, sizeof(t_player) * batch->count);
+		free(batch->views);
+		batch->views = grown;
+	}
+	if (batch_parse_view(&batch->game->map, &batch->views[batch->count], line))
+		return (print_error("Invalid view line"));
+	batch->count++;
+	return (0);
+}
+
+static int	add_lines(t_batch *batch, char *data, size_t len)
+{
+	char	*line;
+	size_t	i;
+	int		cap;
+
+	cap = 0;
+	line = data;
+	i = 0;
+	while (i <= len)
+	{
+		if (i == len || data[i] == '\n')
+		{
+			data[i] = '\0';
+			if (add_view(batch, line, &cap))
+				return (1);
+			line = data + i + 1;
+		}
+		i++;
+	}
+	return (0);
+}
+
+int	batch_load_views(t_batch *batch, const char *path)
+{
+	char	*data;
+	size_t	len;
+	int		status;
+
+	data = read_file(path, &len);
+	if (!data)
+		return (print_error("Unable to read views file"));
+	status = add_lines(batch, data, len);
+	free(data);
+	if (!status && batch->count == 0)
+		return (print_error("Views file is empty"));
+	return (status);
+}
@@ -0,0 +1,82 @@
+#include "cub3d.h"
+
+static void	write_pending(t_batch *batch)
+{
+	int	i;
+
+	i = 0;
+	while (i < batch->pending_count && !batch->failed)
+	{
+		if (batch_write_ppm(batch, &batch->pending[i],
+				batch->pending_first + i))
+			__atomic_store_n(&batch->failed, 1, __ATOMIC_RELEASE);
+		i++;
+	}
+}
+
+static void	*batch_writer(void *param)
+{
+	t_batch	*batch;
+
+	batch = (t_batch *)param;
+	pthread_mutex_lock(&batch->lock);
+	while (1)
+	{
+		while (!batch->pending && !batch->stop)
+			pthread_cond_wait(&batch->cond, &batch->lock);
+		if (!batch->pending)
+			break ;
+		pthread_mutex_unlock(&batch->lock);
+		write_pending(batch);
+		pthread_mutex_lock(&batch->lock);
+		batch->pending = NULL;
+		pthread_cond_broadcast(&batch->cond);
+	}
+	pthread_mutex_unlock(&batch->lock);
+	return (NULL);
+}
+
+int	batch_writer_start(t_batch *batch)
+{
+	pthread_mutex_init(&batch->lock, NULL);
+	pthread_cond_init(&batch->cond, NULL);
+	batch->rgb = safe_malloc((size_t)batch->game->opts.width
+			* batch->game->opts.height * 3);
+	if (pthread_create(&batch->writer, NULL, batch_writer, batch))
+	{
+		pthread_mutex_destroy(&batch->lock);
+		pthread_cond_destroy(&batch->cond);
+		free(batch->rgb);
+		batch->rgb = NULL;
+		return (print_error("Failed to start writer thread"));
+	}
+	return (0);
+}
+
+void	batch_hand_off(t_batch *batch, t_img *frames, int first, int count)
+{
+	pthread_mutex_lock(&batch->lock);
+	while (batch->pending)
+		pthread_cond_wait(&batch->cond, &batch->lock);
+	batch->pending = frames;
+	batch->pending_first = first;
+	batch->pending_count = count;
+	pthread_cond_broadcast(&batch->cond);
+	pthread_mutex_unlock(&batch->lock);
+}
+
+int	batch_writer_stop(t_batch *batch)
+{
+	pthread_mutex_lock(&batch->lock);
+	while (batch->pending)
+		pthread_cond_wait(&batch->cond, &batch->lock);
+	batch->stop = 1;
+	pthread_cond_broadcast(&batch->cond);
+	pthread_mutex_unlock(&batch->lock);
+	pthread_join(batch->writer, NULL);
+	pthread_mutex_destroy(&batch->lock);
+	pthread_cond_destroy(&batch->cond);
+	free(batch->rgb);
+	batch->rgb = NULL;
+	return (batch->failed);
+}
@@ -0,0 +1,105 @@
+#include "cub3d.h"
+#include <stdio.h>
+#include <time.h>
+
+static unsigned int	next_rand(unsigned int *seed)
+{
+	*seed ^= *seed << 13;
+	*seed ^= *seed >> 17;
+	*seed ^= *seed << 5;
+	return (*seed);
+}
+
+static float	rand_unit(unsigned int *seed)
+{
+	return ((next_rand(seed) & 0xFFFFFF) / (float)0x1000000);
+}
+
+static int	spawn_agents(t_game *game, int count)
+{
+	unsigned int	seed;
+	t_entity_desc	desc;
+	int				spawned;
+	int				tries;
+
+	seed = 0x9E3779B9u;
+	spawned = 0;
+	tries = 0;
+	while (spawned < count && tries < count * 64)
+	{
+		tries++;
+		desc.x = rand_unit(&seed) * game->map.width;
+		desc.y = rand_unit(&seed) * game->map.height;
+		if (map_is_solid(&game->map, (int)desc.x, (int)desc.y))
+			continue ;
+		desc.vx = (rand_unit(&seed) - 0.5f) * 0.2f;
+		desc.vy = (rand_unit(&seed) - 0.5f) * 0.2f;
+		desc.radius = 0.1f + rand_unit(&seed) * 0.15f;
+		if (entities_spawn(&game->entities, &desc) >= 0)
+			spawned++;
+	}
+	return (spawned);
+}
+
+static double	now_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6);
+}
+
+static void	run_bench(t_game *game, int threads, int ticks)
+{
+	t_pool	pool;
+	double	start;
+	double	elapsed;
+	int		i;
+
+	pool_init(&pool, threads);
+	entities_tick(&game->entities, &game->map, &pool, 1.0f);
+	start = now_ms();
+	for (i = 0; i < ticks; i++)
+		entities_tick(&game->entities, &game->map, &pool, 1.0f);
+	elapsed = now_ms() - start;
+	printf("threads=%-3d entities=%-7d ticks=%-4d ms/tick=%8.3f "
+		"entities/ms=%10.1f\n", pool.size, game->entities.count, ticks,
+		elapsed / ticks, game->entities.count * ticks / elapsed);
+	pool_destroy(&pool);
+}
+
+int	main(int argc, char **argv)
+{
+	t_game	game;
+	int		count;
+	int		ticks;
+	int		threads;
+	int		t;
+
+	if (argc < 2)
+	{
+		printf("Usage: %s <map.cub> [entities] [ticks] [max_threads]\n",
+			argv[0]);
+		return (1);
+	}
+	ft_bzero(&game, sizeof(game));
+	if (parse_scene(&game, argv[1]))
+		return (2);
+	count = 10000;
+	ticks = 200;
+	threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if (argc > 2)
+		count = atoi(argv[2]);
+	if (argc > 3)
+		ticks = atoi(argv[3]);
+	if (argc > 4)
+		threads = atoi(argv[4]);
+	printf("spawned %d agents on %dx%d map\n", spawn_agents(&game, count),
+		game.map.width, game.map.height);
+	for (t = 1; t <= threads; t *= 2)
+		run_bench(&game, t, ticks);
+	free_entities(&game.entities);
+	free_map(&game.map);
+	free_config(&game.config);
+	return (0);
+}
@@ -0,0 +1,146 @@
+#include "cub3d.h"
+#include <stdio.h>
+#include <time.h>
+
+static double	now_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6);
+}
+
+static unsigned int	next_rand(unsigned int *seed)
+{
+	*seed ^= *seed << 13;
+	*seed ^= *seed >> 17;
+	*seed ^= *seed << 5;
+	return (*seed);
+}
+
+static int	matches_full_build(t_flow *flow, const t_map *map, int *target)
+{
+	t_flow	ref;
+	long	i;
+	int		ok;
+
+	flow_init(&ref, map, flow->radius);
+	flow_add_target(&ref, target[0], target[1]);
+	ok = 1;
+	for (i = 0; i < (long)map->width * map->height; i++)
+		if (ref.dist[i] != flow->dist[i])
+			ok = 0;
+	free_flow(&ref);
+	return (ok);
+}
+
+static void	bench_moves(t_flow *flow, int *target, int moves)
+{
+	unsigned int	seed;
+	double			start;
+	int				step[2];
+	int				done;
+
+	seed = 0x2545F491u;
+	flow->touched = 0;
+	done = 0;
+	start = now_ms();
+	while (done < moves)
+	{
+		step[0] = (int)(next_rand(&seed) % 3) - 1;
+		step[1] = (int)(next_rand(&seed) % 3) - 1;
+		if (flow_move_target(flow, target, target[0] + step[0],
+				target[1] + step[1]) == 0)
+			done++;
+	}
+	printf("incremental target move: %.4f ms/move, %.1f cells touched/move\n",
+		(now_ms() - start) / moves, (double)flow->touched / moves);
+}
+
+static void	bench_cell_toggles(t_flow *flow, t_map *map, int toggles)
+{
+	unsigned int	seed;
+	double			start;
+	int				x;
+	int				y;
+	int				done;
+
+	seed = 0x68E31DA4u;
+	flow->touched = 0;
+	done = 0;
+	start = now_ms();
+	while (done < toggles)
+	{
+		x = next_rand(&seed) % map->width;
+		y = next_rand(&seed) % map->height;
+		if (map_cell(map, x, y) != '0'
+			|| flow->dist[(long)y * map->width + x] == 0)
+			continue ;
+		map_set_cell(map, x, y, '1');
+		flow_cell_changed(flow, x, y);
+		map_set_cell(map, x, y, '0');
+		flow_cell_changed(flow, x, y);
+		done++;
+	}
+	printf("incremental cell toggle:  %.4f ms/toggle, %.1f cells touched\n",
+		(now_ms() - start) / toggles, (double)flow->touched / toggles);
+}
+
+static void	bench_queries(t_flow *flow, const t_map *map, int queries)
+{
+	unsigned int	seed;
+	double			start;
+	int				step[2];
+	long			sum;
+	int				i;
+
+	seed = 0x1B873593u;
+	sum = 0;
+	start = now_ms();
+	for (i = 0; i < queries; i++)
+	{
+		if (flow_direction(flow, next_rand(&seed) % map->width,
+				next_rand(&seed) % map->height, step) == 0)
+			sum += step[0] + step[1];
+	}
+	printf("direction query:          %.2f ns/query (checksum %ld)\n",
+		(now_ms() - start) * 1e6 / queries, sum);
+}
+
+int	main(int argc, char **argv)
+{
+	t_game	game;
+	t_flow	flow;
+	int		target[2];
+	double	start;
+	int		radius;
+
+	if (argc < 2)
+	{
+		printf("Usage: %s <map.cub> [radius]\n", argv[0]);
+		return (1);
+	}
+	ft_bzero(&game, sizeof(game));
+	if (parse_scene(&game, argv[1]))
+		return (2);
+	radius = 0;
+	if (argc > 2)
+		radius = atoi(argv[2]);
+	target[0] = (int)game.player.x;
+	target[1] = (int)game.player.y;
+	printf("map %dx%d, radius %d\n", game.map.width, game.map.height, radius);
+	start = now_ms();
+	flow_init(&flow, &game.map, radius);
+	flow_add_target(&flow, target[0], target[1]);
+	printf("full build:               %.4f ms, %ld cells\n",
+		now_ms() - start, flow.touched);
+	bench_moves(&flow, target, 1000);
+	bench_cell_toggles(&flow, &game.map, 1000);
+	bench_queries(&flow, &game.map, 1000000);
+	printf("incremental == full rebuild: %s\n",
+		matches_full_build(&flow, &game.map, target) ? "yes" : "NO");
+	free_flow(&flow);
+	free_map(&game.map);
+	free_config(&game.config);
+	return (0);
+}
@@ -0,0 +1,96 @@
+#include "cub3d.h"
+#include <stdio.h>
+#include <time.h>
+
+static double	now_ms(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6);
+}
+
+static double	rand_coord(unsigned int *seed, int limit)
+{
+	*seed ^= *seed << 13;
+	*seed ^= *seed >> 17;
+	*seed ^= *seed << 5;
+	return ((*seed & 0xFFFFFF) / (double)0x1000000 * limit);
+}
+
+static int	fill_queries(t_map *map, t_los_query *q, int count)
+{
+	unsigned int	seed;
+	int				i;
+
+	seed = 0xC2B2AE35u;
+	i = 0;
+	while (i < count)
+	{
+		q[i].from_x = rand_coord(&seed, map->width);
+		q[i].from_y = rand_coord(&seed, map->height);
+		q[i].to_x = rand_coord(&seed, map->width);
+		q[i].to_y = rand_coord(&seed, map->height);
+		if (!map_is_solid(map, (int)q[i].from_x, (int)q[i].from_y))
+			i++;
+	}
+	return (count);
+}
+
+static int	run(t_map *map, t_los_query *q, int count, int threads)
+{
+	t_pool	pool;
+	t_los	los;
+	double	start;
+	int		visible;
+	int		i;
+
+	pool_init(&pool, threads);
+	ft_bzero(&los, sizeof(los));
+	los.pool = &pool;
+	los_run(&los, map, q, count);
+	start = now_ms();
+	for (i = 0; i < 20; i++)
+		los_run(&los, map, q, count);
+	visible = 0;
+	for (i = 0; i < count; i++)
+		visible += q[i].visible;
+	printf("threads=%-3d queries=%-7d %8.3f ms/batch %10.1f queries/ms "
+		"visible=%d\n", pool.size, count, (now_ms() - start) / 20,
+		count * 20 / (now_ms() - start), visible);
+	free_los(&los);
+	pool_destroy(&pool);
+	return (visible);
+}
+
+int	main(int argc, char **argv)
+{
+	t_game		game;
+	t_los_query	*queries;
+	int			count;
+	int			threads;
+	int			t;
+
+	if (argc < 2)
+	{
+		printf("Usage: %s <map.cub> [queries] [max_threads]\n", argv[0]);
+		return (1);
+	}
+	ft_bzero(&game, sizeof(game));
+	if (parse_scene(&game, argv[1]))
+		return (2);
+	count = 100000;
+	threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if (argc > 2)
+		count = atoi(argv[2]);
+	if (argc > 3)
+		threads = atoi(argv[3]);
+	queries = safe_malloc(sizeof(t_los_query) * count);
+	fill_queries(&game.map, queries, count);
+	for (t = 1; t <= threads; t *= 2)
+		run(&game.map, queries, count, t);
+	free(queries);
+	free_map(&game.map);
+	free_config(&game.config);
+	return (0);
+}
@@ -0,0 +1,156 @@
+#include "cub3d.h"
+#include <stdio.h>
+#include <string.h>
+#include <wchar.h>
+
+#define BENCH_IMPLS 5
+
+static void	byte_copy(void *dst, const void *src, size_t n)
+{
+	unsigned char		*d;
+	const unsigned char	*s;
+	size_t				i;
+
+	d = dst;
+	s = src;
+	for (i = 0; i < n; i++)
+		d[i] = s[i];
+}
+
+static void	pixel_fill32(void *dst, unsigned int value, size_t count)
+{
+	t_img	img;
+	size_t	x;
+
+	ft_bzero(&img, sizeof(img));
+	img.addr = dst;
+	img.bpp = 32;
+	img.width = count;
+	img.height = 1;
+	img.line_len = count * 4;
+	for (x = 0; x < count; x++)
+		draw_pixel(&img, x, 0, value);
+}
+
+static void	libc_copy(void *dst, const void *src, size_t n)
+{
+	memcpy(dst, src, n);
+}
+
+static void	libc_fill32(void *dst, unsigned int value, size_t count)
+{
+	wmemset(dst, (wchar_t)value, count);
+}
+
+static int	verify(const t_memops *ops, unsigned char *a, unsigned char *b)
+{
+	size_t	n;
+	size_t	off;
+	size_t	i;
+
+	for (n = 0; n < 600; n += 1 + n / 16)
+	{
+		for (off = 0; off < 8; off++)
+		{
+			memset(a, 0xEE, 4096);
+			memset(b, 0xEE, 4096);
+			for (i = 0; i < n; i++)
+				a[2048 + i] = (unsigned char)(i * 7 + off);
+			ops->copy(b + 16 + off, a + 2048 + (off ^ 5), n);
+			memcpy(a + 16 + off, a + 2048 + (off ^ 5), n);
+			if (memcmp(a, b, 2048))
+				return (1);
+			memset(b, 0xEE, 4096);
+			ops->fill32(b + 16 + off, 0x11223344u, n);
+			memset(a, 0xEE, 4096);
+			wmemset((wchar_t *)(a + 16), 0x11223344, n);
+			if (memcmp(a + 16, b + 16 + off, n * 4) || b[15 + off] != 0xEE
+				|| b[16 + off + n * 4] != 0xEE)
+				return (1);
+		}
+	}
+	return (0);
+}
+
+static double	gbps(t_copy_fn copy, t_fill32_fn fill, char *buf, size_t bytes)
+{
+	long	iters;
+	long	i;
+	long	usec;
+
+	iters = (1L << 30) / (long)bytes + 3;
+	if (copy)
+		copy(buf + bytes, buf, bytes);
+	else
+		fill(buf, 0x00808080u, bytes / 4);
+	usec = now_usec();
+	for (i = 0; i < iters; i++)
+	{
+		if (copy)
+			copy(buf + bytes, buf, bytes);
+		else
+			fill(buf, (unsigned int)i, bytes / 4);
+	}
+	usec = now_usec() - usec;
+	return ((double)bytes * iters / 1000.0 / (usec + 1));
+}
+
+static void	run_table(const char *title, int is_copy, char *buf)
+{
+	static const size_t	sizes[] = {64, 256, 4096, 65536, 1 << 20,
+		WIN_WIDTH * WIN_HEIGHT * 4};
+	const char			*names[BENCH_IMPLS] = {"byte", "word", "sse2",
+		"avx2", "libc"};
+	const t_memops		*ops;
+	size_t				s;
+	int					k;
+
+	printf("%-7s %9s", title, "bytes");
+	for (k = 0; k < BENCH_IMPLS; k++)
+		printf(" %8s", names[k]);
+	printf("   (GB/s)\n");
+	for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+	{
+		printf("%-7s %9zu", "", sizes[s]);
+		for (k = 0; k < BENCH_IMPLS; k++)
+		{
+			ops = mem_ops_level(k - 1);
+			if (k == 0 && is_copy)
+				printf(" %8.2f", gbps(byte_copy, NULL, buf, sizes[s]));
+			else if (k == 0)
+				printf(" %8.2f", gbps(NULL, pixel_fill32, buf, sizes[s]));
+			else if (k == BENCH_IMPLS - 1)
+				printf(" %8.2f", gbps(is_copy ? libc_copy : NULL,
+						libc_fill32, buf, sizes[s]));
+			else if (!ops)
+				printf(" %8s", "n/a");
+			else
+				printf(" %8.2f", gbps(is_copy ? ops->copy : NULL,
+						ops->fill32, buf, sizes[s]));
+			fflush(stdout);
+		}
+		printf("\n");
+	}
+}
+
+int	main(void)
+{
+	unsigned char	a[4096];
+	unsigned char	b[4096];
+	char			*buf;
+	int				level;
+
+	printf("dispatch: %s\n", mem_ops()->name);
+	for (level = 0; level < MEM_LEVELS; level++)
+	{
+		if (!mem_ops_level(level))
+			continue ;
+		printf("verify %s: %s\n", mem_ops_level(level)->name,
+			verify(mem_ops_level(level), a, b) ? "FAILED" : "ok");
+	}
+	buf = safe_malloc((size_t)WIN_WIDTH * WIN_HEIGHT * 8 + 64);
+	run_table("copy", 1, buf);
+	run_table("fill32", 0, buf);
+	free(buf);
+	return (0);
+}
@@ -0,0 +1,52 @@
+#include "cub3d.h"
+#include <stdio.h>
+
+static int	parse_once(const char *path, long *usec, long *mallocs,
+		t_map *shape)
+{
+	t_game	game;
+	int		status;
+
+	ft_bzero(&game, sizeof(game));
+	*mallocs = malloc_calls(0);
+	*usec = now_usec();
+	status = parse_scene(&game, path);
+	*usec = now_usec() - *usec;
+	*mallocs = malloc_calls(0) - *mallocs;
+	shape->width = game.map.width;
+	shape->height = game.map.height;
+	free_config(&game.config);
+	free_map(&game.map);
+	return (status);
+}
+
+int	main(int argc, char **argv)
+{
+	t_map	shape;
+	long	usec;
+	long	mallocs;
+	long	best;
+	int		runs;
+	int		i;
+
+	if (argc < 2)
+	{
+		printf("Usage: %s <map.cub> [runs]\n", argv[0]);
+		return (1);
+	}
+	runs = 5;
+	if (argc > 2)
+		runs = atoi(argv[2]);
+	best = -1;
+	for (i = 0; i < runs; i++)
+	{
+		if (parse_once(argv[1], &usec, &mallocs, &shape))
+			return (2);
+		if (best < 0 || usec < best)
+			best = usec;
+	}
+	printf("map=%dx%d parse=%.3f ms (best of %d) mallocs=%ld "
+		"(%.3f per row)\n", shape.width, shape.height, best / 1000.0,
+		runs, mallocs, (double)mallocs / (shape.height + (shape.height == 0)));
+	return (0);
+}
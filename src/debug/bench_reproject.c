@@ -0,0 +1,141 @@
+#include "cub3d.h"
+#include <stdio.h>
+
+static double	frame_error(const t_img *a, const t_img *b, long *bad)
+{
+	const unsigned int	*pa;
+	const unsigned int	*pb;
+	double				sq;
+	int					d;
+	long				i;
+	int					c;
+
+	pa = (const unsigned int *)a->addr;
+	pb = (const unsigned int *)b->addr;
+	sq = 0;
+	for (i = 0; i < (long)a->width * a->height; i++)
+	{
+		*bad += ((pa[i] ^ pb[i]) & 0xFFFFFF) != 0;
+		for (c = 0; c < 24; c += 8)
+		{
+			d = (int)((pa[i] >> c) & 0xFF) - (int)((pb[i] >> c) & 0xFF);
+			sq += d * d;
+		}
+	}
+	return (sq / ((double)a->width * a->height * 3));
+}
+
+static double	psnr(double mse)
+{
+	if (mse <= 0)
+		return (99.99);
+	return (10.0 * log10(255.0 * 255.0 / mse));
+}
+
+static void	drive(t_game *game, int path, int tick)
+{
+	ft_bzero(&game->input, sizeof(t_input));
+	if (path == 'w')
+	{
+		game->input.forward = (tick / 40) % 4 != 3;
+		game->input.turn_left = (tick / 40) % 4 == 1;
+		game->input.turn_right = (tick / 40) % 4 == 3;
+	}
+	else if (path == 's')
+	{
+		game->input.left = (tick / 60) % 2 == 0;
+		game->input.right = (tick / 60) % 2 == 1;
+	}
+	else
+		game->input.turn_left = 1;
+}
+
+static void	run_bench(t_game *game, const t_player *spawn, int *cfg, int tol)
+{
+	t_view	view;
+	t_img	ref;
+	long	us[3];
+	long	bad;
+	double	err[3];
+	int		i;
+
+	free_reproj(game);
+	game->opts.reproject = tol;
+	game->player = *spawn;
+	view_target_init(game, &ref, game->frame.width, game->frame.height);
+	ft_bzero(us, sizeof(us));
+	ft_bzero(err, sizeof(err));
+	bad = 0;
+	for (i = 0; i < cfg[0] * cfg[1]; i++)
+	{
+		drive(game, cfg[2], i);
+		update_game_state(game);
+		if ((i + 1) % cfg[1])
+			continue ;
+		us[0] = now_usec();
+		render_frame(game);
+		us[1] += now_usec() - us[0];
+		view.cam = game->player;
+		view.target = &ref;
+		view.steps = 0;
+		view.stats = NULL;
+		us[0] = now_usec();
+		render_views(game, &view, 1);
+		us[2] += now_usec() - us[0];
+		err[0] = frame_error(&game->frame, &ref, &bad);
+		err[1] += err[0];
+		if (err[0] > err[2])
+			err[2] = err[0];
+	}
+	printf("tol=%-3d reuse=%5.1f%% full=%-4ld %7.3f ms/frame vs %7.3f ms "
+		"(%.2fx)  psnr=%5.2f dB worst=%5.2f dB bad=%.3f%%\n", tol,
+		100.0 * game->reproj.copied / (game->reproj.columns + 1e-9),
+		game->reproj.full, us[1] / 1000.0 / cfg[0], us[2] / 1000.0 / cfg[0],
+		(double)us[2] / (us[1] + 1), psnr(err[1] / cfg[0]), psnr(err[2]),
+		100.0 * bad / ((double)cfg[0] * ref.width * ref.height));
+	release_image(game, &ref);
+}
+
+int	main(int argc, char **argv)
+{
+	static int	tols[] = {0, 1, 2, 4, 8, 16};
+	t_game		game;
+	t_player	spawn;
+	int			cfg[3];
+	int			i;
+
+	if (argc < 2)
+	{
+		printf("Usage: %s <map.cub> [walk|turn|strafe] [frames] "
+			"[ticks_per_frame] [tol...]\n", argv[0]);
+		return (1);
+	}
+	ft_bzero(&game, sizeof(game));
+	game.opts.map_path = argv[1];
+	game.opts.headless = 1;
+	cfg[0] = 240;
+	cfg[1] = 1;
+	cfg[2] = 'w';
+	if (argc > 2)
+		cfg[2] = argv[2][0];
+	if (argc > 3)
+		cfg[0] = atoi(argv[3]);
+	if (argc > 4)
+		cfg[1] = atoi(argv[4]);
+	if (cfg[0] < 1 || cfg[1] < 1 || parse_scene(&game, argv[1])
+		|| init_game(&game))
+	{
+		destroy_game(&game);
+		return (2);
+	}
+	spawn = game.player;
+	printf("%s: %dx%d, %s path, %d frames, %d tick(s) per frame\n", argv[1],
+		game.frame.width, game.frame.height, argc > 2 ? argv[2] : "walk",
+		cfg[0], cfg[1]);
+	for (i = 5; i < argc; i++)
+		run_bench(&game, &spawn, cfg, atoi(argv[i]));
+	for (i = 0; argc <= 5 && i < (int)(sizeof(tols) / sizeof(*tols)); i++)
+		run_bench(&game, &spawn, cfg, tols[i]);
+	destroy_game(&game);
+	return (0);
+}
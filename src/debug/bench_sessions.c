@@ -0,0 +1,88 @@
+#include "cub3d.h"
+#include <stdio.h>
+
+static long	shared_bytes(t_game *game)
+{
+	long	bytes;
+	long	i;
+	int		t;
+
+	bytes = (long)game->map.chunk_cols * game->map.chunk_rows * sizeof(char *);
+	i = 0;
+	while (i < (long)game->map.chunk_cols * game->map.chunk_rows)
+	{
+		if (map_chunk_owned(&game->map, game->map.chunks[i]))
+			bytes += CHUNK_CELLS;
+		i++;
+	}
+	bytes += game->map.store_size;
+	t = 0;
+	while (t < game->textures.count)
+	{
+		bytes += (long)game->tex[t].line_len * game->tex[t].height;
+		t++;
+	}
+	return (bytes);
+}
+
+static void	run_bench(t_game *host, int sessions, int ticks)
+{
+	t_runtime	rt;
+	long		start;
+	long		frames;
+	double		per_sec;
+	int			i;
+
+	if (runtime_init(&rt, host, sessions))
+		return ;
+	start = now_usec();
+	for (i = 0; i < ticks && runtime_tick(&rt) > 0; i++)
+		;
+	start = now_usec() - start;
+	frames = 0;
+	for (i = 0; i < rt.count; i++)
+		frames += rt.sessions[i].frames;
+	per_sec = frames * 1e6 / (start + 1);
+	printf("sessions=%-4d threads=%-3d frames=%-7ld %9.1f frames/s "
+		"%7.3f ms/frame  %6.2f sessions/core@60Hz\n", sessions,
+		host->pool.size, frames, per_sec, host->pool.size * 1000.0
+		/ (per_sec + 1e-9), per_sec / 60.0 / host->pool.size);
+	runtime_destroy(&rt);
+}
+
+int	main(int argc, char **argv)
+{
+	t_game	game;
+	int		max_sessions;
+	int		ticks;
+	int		n;
+
+	if (argc < 2)
+	{
+		printf("Usage: %s <map.cub> [max_sessions] [ticks] [trace]\n",
+			argv[0]);
+		return (1);
+	}
+	ft_bzero(&game, sizeof(game));
+	game.opts.map_path = argv[1];
+	game.opts.headless = 1;
+	max_sessions = 16;
+	ticks = 60;
+	if (argc > 2)
+		max_sessions = atoi(argv[2]);
+	if (argc > 3)
+		ticks = atoi(argv[3]);
+	if (parse_scene(&game, argv[1]) || init_game(&game)
+		|| (argc > 4 && trace_load(&game, argv[4])))
+	{
+		destroy_game(&game);
+		return (2);
+	}
+	printf("shared assets: %ld bytes, per session: %ld bytes\n",
+		shared_bytes(&game), (long)sizeof(t_session)
+		+ (long)game.frame.line_len * game.frame.height);
+	for (n = 1; n <= max_sessions; n *= 2)
+		run_bench(&game, n, ticks);
+	destroy_game(&game);
+	return (0);
+}
@@ -24,16 +24,30 @@ static void print_config(t_config *cfg)
 	}
 	print_color("FLOOR", &cfg->floor, cfg->floor_set);
 	print_color("CEILING", &cfg->ceiling, cfg->ceiling_set);
+	for (i = 0; i < cfg->mat_count; i++)
+		printf("MAT %c: %s %s %s %s\n", cfg->mat[i].code,
+			cfg->mat[i].face[0], cfg->mat[i].face[1],
+			cfg->mat[i].face[2], cfg->mat[i].face[3]);
+	for (i = 0; i < cfg->light_count; i++)
+		printf("LIGHT %.2f %.2f intensity=%.2f radius=%.2f\n",
+			cfg->light[i].x, cfg->light[i].y,
+			cfg->light[i].intensity, cfg->light[i].radius);
+	if (cfg->fog_set)
+		printf("FOG %.2f r=%d g=%d b=%d\n", cfg->fog_dist,
+			cfg->fog.r, cfg->fog.g, cfg->fog.b);
 }
 
 static void print_map(t_map *map)
 {
 	int y;
+	int x;
 
 	printf("--- MAP (width=%d height=%d) ---\n", map->width, map->height);
 	for (y = 0; y < map->height; y++)
 	{
-		printf("%s\n", map->grid[y]);
+		for (x = 0; x < map->width; x++)
+			putchar(map_cell(map, x, y));
+		putchar('\n');
 	}
 }
 
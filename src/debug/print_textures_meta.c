@@ -25,10 +25,10 @@ int main(int argc, char **argv)
     }
 
     printf("--- TEXTURES META ---\n");
-    for (i = 0; i < TEX_COUNT; i++)
+    for (i = 0; i < game.textures.count; i++)
     {
-        t_img *tex = &game.texture[i];
-        printf("TEX %d:\n", i);
+        t_img *tex = &game.tex[i];
+        printf("TEX %d: %s\n", i, game.textures.path[i]);
         printf("  ptr: %p\n", tex->ptr);
         printf("  addr: %p\n", tex->addr);
         printf("  width: %d height: %d\n", tex->width, tex->height);
@@ -0,0 +1,50 @@
+#include "cub3d.h"
+
+unsigned int	entity_hash_cell(int cx, int cy, unsigned int mask)
+{
+	return (((unsigned int)cx * 73856093u ^ (unsigned int)cy * 19349663u)
+		& mask);
+}
+
+static void	resize_buckets(t_entities *ents)
+{
+	unsigned int	buckets;
+
+	buckets = 64;
+	while (buckets < (unsigned int)ents->count * 2)
+		buckets <<= 1;
+	if (buckets - 1 == ents->bucket_mask && ents->bucket_start)
+		return ;
+	free(ents->bucket_start);
+	ents->bucket_start = safe_malloc(sizeof(int) * (buckets + 1));
+	ents->bucket_mask = buckets - 1;
+}
+
+void	entities_build_hash(t_entities *ents)
+{
+	int				i;
+	unsigned int	b;
+
+	resize_buckets(ents);
+	ents->cell_size = ents->max_radius * 2.0f;
+	ft_bzero(ents->bucket_start, sizeof(int) * (ents->bucket_mask + 2));
+	i = 0;
+	while (i < ents->count)
+	{
+		b = entity_hash_cell((int)floorf(ents->next_x[i] / ents->cell_size),
+				(int)floorf(ents->next_y[i] / ents->cell_size),
+				ents->bucket_mask);
+		ents->bucket_of[i] = b;
+		ents->bucket_start[b]++;
+		i++;
+	}
+	b = 1;
+	while (b <= ents->bucket_mask + 1)
+	{
+		ents->bucket_start[b] += ents->bucket_start[b - 1];
+		b++;
+	}
+	i = ents->count;
+	while (i-- > 0)
+		ents->sorted[--ents->bucket_start[ents->bucket_of[i]]] = i;
+}
@@ -0,0 +1,78 @@
+#include "cub3d.h"
+
+static void	integrate_range(t_entities *ents, int begin, int end, float dt)
+{
+	float *restrict			out;
+	const float *restrict	pos;
+	const float *restrict	vel;
+	int						i;
+
+	out = ents->next_x;
+	pos = ents->x;
+	vel = ents->vx;
+	i = begin;
+	while (i < end)
+	{
+		out[i] = pos[i] + vel[i] * dt;
+		i++;
+	}
+	out = ents->next_y;
+	pos = ents->y;
+	vel = ents->vy;
+	i = begin;
+	while (i < end)
+	{
+		out[i] = pos[i] + vel[i] * dt;
+		i++;
+	}
+}
+
+static int	swept_free(t_entities *ents, const t_map *map, int i)
+{
+	int	min[2];
+	int	max[2];
+	int	x;
+
+	min[0] = (int)floorf(fminf(ents->x[i], ents->next_x[i]) - ents->radius[i]);
+	min[1] = (int)floorf(fminf(ents->y[i], ents->next_y[i]) - ents->radius[i]);
+	max[0] = (int)floorf(fmaxf(ents->x[i], ents->next_x[i]) + ents->radius[i]);
+	max[1] = (int)floorf(fmaxf(ents->y[i], ents->next_y[i]) + ents->radius[i]);
+	if (max[0] - min[0] > 2 || max[1] - min[1] > 2)
+		return (0);
+	while (min[1] <= max[1])
+	{
+		x = min[0];
+		while (x <= max[0])
+		{
+			if (map_is_solid(map, x, min[1]))
+				return (0);
+			x++;
+		}
+		min[1]++;
+	}
+	return (1);
+}
+
+void	entities_move_range(void *ctx, int begin, int end)
+{
+	t_entity_tick	*tick;
+	t_entities		*ents;
+	int				i;
+
+	tick = (t_entity_tick *)ctx;
+	ents = tick->ents;
+	integrate_range(ents, begin, end, tick->dt);
+	i = begin;
+	while (i < end)
+	{
+		ents->state[i] &= ~(ENT_HIT_WALL | ENT_HIT_AGENT);
+		if (!(ents->state[i] & ENT_ACTIVE))
+		{
+			ents->next_x[i] = ents->x[i];
+			ents->next_y[i] = ents->y[i];
+		}
+		else if (!swept_free(ents, tick->map, i))
+			entity_sweep(ents, tick->map, i, tick->dt);
+		i++;
+	}
+}
@@ -0,0 +1,105 @@
+#include "cub3d.h"
+
+static void	push_apart(t_entities *ents, int i, int j, float *corr)
+{
+	float	dx;
+	float	dy;
+	float	min_dist;
+	float	dist;
+
+	dx = ents->next_x[i] - ents->next_x[j];
+	dy = ents->next_y[i] - ents->next_y[j];
+	min_dist = ents->radius[i] + ents->radius[j];
+	dist = dx * dx + dy * dy;
+	if (dist >= min_dist * min_dist)
+		return ;
+	if (dist == 0.0f)
+	{
+		if (i < j)
+			corr[0] += min_dist * 0.5f;
+		else
+			corr[0] -= min_dist * 0.5f;
+		return ;
+	}
+	dist = sqrtf(dist);
+	corr[0] += dx * (min_dist - dist) * 0.5f / dist;
+	corr[1] += dy * (min_dist - dist) * 0.5f / dist;
+}
+
+static void	scan_cell(t_entities *ents, int i, int *cell, float *corr)
+{
+	unsigned int	b;
+	int				k;
+	int				j;
+
+	b = entity_hash_cell(cell[0], cell[1], ents->bucket_mask);
+	k = ents->bucket_start[b];
+	while (k < ents->bucket_start[b + 1])
+	{
+		j = ents->sorted[k++];
+		if (j == i
+			|| (int)floorf(ents->next_x[j] / ents->cell_size) != cell[0]
+			|| (int)floorf(ents->next_y[j] / ents->cell_size) != cell[1])
+			continue ;
+		push_apart(ents, i, j, corr);
+	}
+}
+
+static void	collect_corrections(t_entities *ents, int i, float *corr)
+{
+	int	home[2];
+	int	cell[2];
+
+	home[0] = (int)floorf(ents->next_x[i] / ents->cell_size);
+	home[1] = (int)floorf(ents->next_y[i] / ents->cell_size);
+	cell[1] = home[1] - 1;
+	while (cell[1] <= home[1] + 1)
+	{
+		cell[0] = home[0] - 1;
+		while (cell[0] <= home[0] + 1)
+		{
+			scan_cell(ents, i, cell, corr);
+			cell[0]++;
+		}
+		cell[1]++;
+	}
+}
+
+static void	apply_correction(t_entities *ents, const t_map *map, int i,
+			float *corr)
+{
+	float	limit;
+	float	tx;
+	float	ty;
+
+	limit = ents->radius[i];
+	corr[0] = fmaxf(-limit, fminf(limit, corr[0]));
+	corr[1] = fmaxf(-limit, fminf(limit, corr[1]));
+	tx = ents->next_x[i] + corr[0];
+	ty = ents->next_y[i] + corr[1];
+	ents->x[i] = ents->next_x[i];
+	ents->y[i] = ents->next_y[i];
+	if (!map_is_solid(map, (int)floorf(tx), (int)floorf(ents->y[i])))
+		ents->x[i] = tx;
+	if (!map_is_solid(map, (int)floorf(ents->x[i]), (int)floorf(ty)))
+		ents->y[i] = ty;
+	if (corr[0] != 0.0f || corr[1] != 0.0f)
+		ents->state[i] |= ENT_HIT_AGENT;
+}
+
+void	entities_separate_range(void *ctx, int begin, int end)
+{
+	t_entity_tick	*tick;
+	float			corr[2];
+
+	tick = (t_entity_tick *)ctx;
+	while (begin < end)
+	{
+		corr[0] = 0.0f;
+		corr[1] = 0.0f;
+		if (tick->ents->state[begin] & ENT_ACTIVE)
+			collect_corrections(tick->ents, begin, corr);
+		apply_correction(tick->ents, tick->map, begin, corr);
+		begin++;
+	}
+}
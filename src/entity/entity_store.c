@@ -0,0 +1,75 @@
+#include "cub3d.h"
+
+static float	*grow_floats(float *old, int count, int capacity)
+{
+	float	*tmp;
+
+	tmp = safe_malloc(sizeof(float) * capacity);
+	if (old)
+		ft_memcpy(tmp, old, sizeof(float) * count);
+	free(old);
+	return (tmp);
+}
+
+static void	entities_reserve(t_entities *ents, int capacity)
+{
+	unsigned char	*state;
+
+	if (capacity <= ents->capacity)
+		return ;
+	if (capacity < ents->capacity * 2)
+		capacity = ents->capacity * 2;
+	ents->x = grow_floats(ents->x, ents->count, capacity);
+	ents->y = grow_floats(ents->y, ents->count, capacity);
+	ents->vx = grow_floats(ents->vx, ents->count, capacity);
+	ents->vy = grow_floats(ents->vy, ents->count, capacity);
+	ents->radius = grow_floats(ents->radius, ents->count, capacity);
+	ents->next_x = grow_floats(ents->next_x, 0, capacity);
+	ents->next_y = grow_floats(ents->next_y, 0, capacity);
+	state = safe_malloc(capacity);
+	if (ents->state)
+		ft_memcpy(state, ents->state, ents->count);
+	free(ents->state);
+	ents->state = state;
+	free(ents->bucket_of);
+	free(ents->sorted);
+	ents->bucket_of = safe_malloc(sizeof(int) * capacity);
+	ents->sorted = safe_malloc(sizeof(int) * capacity);
+	ents->capacity = capacity;
+}
+
+int	entities_spawn(t_entities *ents, t_entity_desc *desc)
+{
+	int	id;
+
+	if (desc->radius <= 0.0f || desc->radius > ENT_MAX_RADIUS)
+		return (-1);
+	entities_reserve(ents, ents->count + 1);
+	id = ents->count;
+	ents->x[id] = desc->x;
+	ents->y[id] = desc->y;
+	ents->vx[id] = desc->vx;
+	ents->vy[id] = desc->vy;
+	ents->radius[id] = desc->radius;
+	ents->state[id] = ENT_ACTIVE;
+	if (desc->radius > ents->max_radius)
+		ents->max_radius = desc->radius;
+	ents->count++;
+	return (id);
+}
+
+void	free_entities(t_entities *ents)
+{
+	free(ents->x);
+	free(ents->y);
+	free(ents->vx);
+	free(ents->vy);
+	free(ents->radius);
+	free(ents->next_x);
+	free(ents->next_y);
+	free(ents->state);
+	free(ents->bucket_of);
+	free(ents->sorted);
+	free(ents->bucket_start);
+	ft_bzero(ents, sizeof(t_entities));
+}
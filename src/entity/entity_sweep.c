@@ -0,0 +1,111 @@
+#include "cub3d.h"
+
+static int	span_blocked(const t_map *map, int axis, int fixed,
+			const float *span)
+{
+	int	cell;
+	int	last;
+
+	cell = (int)floorf(span[0]);
+	last = (int)floorf(span[1]);
+	while (cell <= last)
+	{
+		if (axis == 0 && map_is_solid(map, fixed, cell))
+			return (1);
+		if (axis == 1 && map_is_solid(map, cell, fixed))
+			return (1);
+		cell++;
+	}
+	return (0);
+}
+
+static int	sweep_x(const t_map *map, float *pos, float step, float r)
+{
+	float	span[2];
+	float	edge;
+	int		col;
+
+	edge = pos[0] + r;
+	if (step < 0.0f)
+		edge = pos[0] - r;
+	col = (int)floorf(edge + step);
+	pos[0] += step;
+	if (col == (int)floorf(pos[0] - step))
+		return (0);
+	span[0] = pos[1] - r;
+	span[1] = pos[1] + r - ENT_EPSILON;
+	if (!span_blocked(map, 0, col, span))
+		return (0);
+	if (step > 0.0f)
+		pos[0] = col - r - ENT_EPSILON;
+	else
+		pos[0] = col + 1 + r + ENT_EPSILON;
+	return (1);
+}
+
+static int	sweep_y(const t_map *map, float *pos, float step, float r)
+{
+	float	span[2];
+	float	edge;
+	int		row;
+
+	edge = pos[1] + r;
+	if (step < 0.0f)
+		edge = pos[1] - r;
+	row = (int)floorf(edge + step);
+	pos[1] += step;
+	if (row == (int)floorf(pos[1] - step))
+		return (0);
+	span[0] = pos[0] - r;
+	span[1] = pos[0] + r - ENT_EPSILON;
+	if (!span_blocked(map, 1, row, span))
+		return (0);
+	if (step > 0.0f)
+		pos[1] = row - r - ENT_EPSILON;
+	else
+		pos[1] = row + 1 + r + ENT_EPSILON;
+	return (1);
+}
+
+static int	sweep_steps(const t_entities *ents, int i, float dt, float *step)
+{
+	int	n;
+
+	n = (int)(fmaxf(fabsf(ents->next_x[i] - ents->x[i]),
+				fabsf(ents->next_y[i] - ents->y[i])) / ents->radius[i]) + 1;
+	if (n > ENT_MAX_SUBSTEPS)
+		n = ENT_MAX_SUBSTEPS;
+	step[0] = fmaxf(-ents->radius[i], fminf(ents->radius[i],
+				ents->vx[i] * dt / n));
+	step[1] = fmaxf(-ents->radius[i], fminf(ents->radius[i],
+				ents->vy[i] * dt / n));
+	return (n);
+}
+
+void	entity_sweep(t_entities *ents, const t_map *map, int i, float dt)
+{
+	float	pos[2];
+	float	step[2];
+	int		n;
+	int		hit;
+
+	pos[0] = ents->x[i];
+	pos[1] = ents->y[i];
+	n = sweep_steps(ents, i, dt, step);
+	hit = 0;
+	while (n-- > 0)
+	{
+		if (step[0] != 0.0f && sweep_x(map, pos, step[0], ents->radius[i]))
+			hit |= 1;
+		if (step[1] != 0.0f && sweep_y(map, pos, step[1], ents->radius[i]))
+			hit |= 2;
+	}
+	if (hit & 1)
+		ents->vx[i] = 0.0f;
+	if (hit & 2)
+		ents->vy[i] = 0.0f;
+	ents->next_x[i] = pos[0];
+	ents->next_y[i] = pos[1];
+	if (hit)
+		ents->state[i] |= ENT_HIT_WALL;
+}
@@ -0,0 +1,16 @@
+#include "cub3d.h"
+
+void	entities_tick(t_entities *ents, const t_map *map, t_pool *pool,
+			float dt)
+{
+	t_entity_tick	tick;
+
+	if (ents->count == 0)
+		return ;
+	tick.ents = ents;
+	tick.map = map;
+	tick.dt = dt;
+	pool_run(pool, entities_move_range, &tick, ents->count);
+	entities_build_hash(ents);
+	pool_run(pool, entities_separate_range, &tick, ents->count);
+}
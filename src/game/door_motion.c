@@ -0,0 +1,99 @@
+#include "cub3d.h"
+
+int	map_door_blocks(const t_map *map, int x, int y)
+{
+	const t_door	*door;
+
+	door = map_door(map, map_cell_key(map, x, y));
+	return (!door || door->open < DOOR_PASSABLE);
+}
+
+void	door_toggle(t_map *map, t_door *door)
+{
+	t_doors	*doors;
+	long	*moving;
+	int		opening;
+
+	doors = &map->doors;
+	opening = door->speed > 0 || (door->speed == 0 && door->open > 0);
+	if (door->speed == 0)
+	{
+		if (doors->moving_count == doors->moving_cap)
+		{
+			doors->moving_cap = doors->moving_cap * 2 + 8;
+			moving = safe_malloc(sizeof(long) * doors->moving_cap);
+			ft_memcpy(moving, doors->moving,
+				sizeof(long) * doors->moving_count);
+			free(doors->moving);
+			doors->moving = moving;
+		}
+		doors->moving[doors->moving_count++] = door->key;
+	}
+	door->speed = DOOR_SPEED;
+	if (opening)
+		door->speed = -DOOR_SPEED;
+}
+
+static int	door_step(t_game *game, t_door *door)
+{
+	const t_map	*map;
+	long		chunk;
+	float		next;
+	int			crossing;
+
+	next = door->open + door->speed;
+	crossing = (door->open < DOOR_PASSABLE) != (next < DOOR_PASSABLE);
+	if (crossing && world_lock(game))
+		return (1);
+	door->open = next;
+	if (door->open <= 0.0f || door->open >= 1.0f)
+	{
+		door->open = (door->open >= 1.0f);
+		door->speed = 0.0f;
+	}
+	if (!crossing)
+		return (door->speed != 0.0f);
+	map = &game->map;
+	chunk = door->key >> (CHUNK_SHIFT * 2);
+	world_cell_changed(game, (int)(chunk % map->chunk_cols) * CHUNK_SIZE
+		+ (door->key & CHUNK_MASK), (int)(chunk / map->chunk_cols)
+		* CHUNK_SIZE + (door->key >> CHUNK_SHIFT & CHUNK_MASK));
+	world_unlock(game);
+	return (door->speed != 0.0f);
+}
+
+void	doors_tick(t_game *game)
+{
+	t_doors	*doors;
+	t_door	*door;
+	int		i;
+
+	doors = &game->map.doors;
+	i = 0;
+	while (i < doors->moving_count)
+	{
+		door = map_door(&game->map, doors->moving[i]);
+		if (door && door_step(game, door))
+			i++;
+		else
+			doors->moving[i] = doors->moving[--doors->moving_count];
+	}
+}
+
+void	map_doors_clone(t_doors *dst, const t_doors *src)
+{
+	*dst = *src;
+	dst->items = NULL;
+	dst->moving = NULL;
+	if (src->cap)
+	{
+		dst->items = safe_malloc(sizeof(t_door) * src->cap);
+		ft_memcpy(dst->items, src->items, sizeof(t_door) * src->count);
+	}
+	if (src->moving_cap)
+	{
+		dst->moving = safe_malloc(sizeof(long) * src->moving_cap);
+		ft_memcpy(dst->moving, src->moving,
+			sizeof(long) * src->moving_count);
+	}
+}
@@ -0,0 +1,71 @@
+#include "cub3d.h"
+
+static int	door_lower_bound(const t_doors *doors, long key)
+{
+	int	lo;
+	int	hi;
+	int	mid;
+
+	lo = 0;
+	hi = doors->count;
+	while (lo < hi)
+	{
+		mid = (lo + hi) / 2;
+		if (doors->items[mid].key < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return (lo);
+}
+
+t_door	*map_door(const t_map *map, long key)
+{
+	int	i;
+
+	i = door_lower_bound(&map->doors, key);
+	if (i < map->doors.count && map->doors.items[i].key == key)
+		return (&map->doors.items[i]);
+	return (NULL);
+}
+
+static void	door_insert(t_doors *doors, int i, long key)
+{
+	t_door	*items;
+	int		j;
+
+	if (doors->count == doors->cap)
+	{
+		doors->cap = doors->cap * 2 + 16;
+		items = safe_malloc(sizeof(t_door) * doors->cap);
+		ft_memcpy(items, doors->items, sizeof(t_door) * doors->count);
+		free(doors->items);
+		doors->items = items;
+	}
+	j = doors->count;
+	while (--j >= i)
+		doors->items[j + 1] = doors->items[j];
+	doors->items[i] = (t_door){key, 0.0f, 0.0f};
+	doors->count++;
+}
+
+void	map_door_set(t_map *map, int x, int y, int present)
+{
+	t_doors	*doors;
+	long	key;
+	int		i;
+
+	doors = &map->doors;
+	key = map_cell_key(map, x, y);
+	i = door_lower_bound(doors, key);
+	if (present == (i < doors->count && doors->items[i].key == key))
+		return ;
+	if (present)
+		door_insert(doors, i, key);
+	else
+	{
+		while (++i < doors->count)
+			doors->items[i - 1] = doors->items[i];
+		doors->count--;
+	}
+}
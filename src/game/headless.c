@@ -0,0 +1,59 @@
+#include "cub3d.h"
+
+int	load_texture_file(t_img *tex, const char *path)
+{
+	char	*data;
+	size_t	len;
+	int		status;
+
+	data = read_file(path, &len);
+	if (!data)
+		return (print_error("Failed to load texture"));
+	status = xpm_decode(tex, data);
+	free(data);
+	return (status);
+}
+
+int	init_headless(t_game *game)
+{
+	ft_bzero(&game->input, sizeof(t_input));
+	view_setup(game);
+	game->frame.width = game->opts.width;
+	game->frame.height = game->opts.height;
+	game->frame.bpp = 32;
+	game->frame.line_len = game->opts.width * 4;
+	game->frame.addr = safe_malloc((long)game->opts.width
+			* game->opts.height * 4);
+	if (init_textures(game))
+		return (1);
+	pool_init(&game->pool, 0);
+	lightmap_build(game);
+	fog_build(game);
+	game->running = 1;
+	return (0);
+}
+
+void	release_image(t_game *game, t_img *img)
+{
+	if (img->ptr)
+		mlx_destroy_image(game->mlx, img->ptr);
+	else
+		free(img->addr);
+	img->ptr = NULL;
+	img->addr = NULL;
+}
+
+void	destroy_textures(t_game *game)
+{
+	int	i;
+
+	i = 0;
+	while (game->tex && i < game->textures.count)
+	{
+		release_image(game, &game->tex[i]);
+		i++;
+	}
+	free(game->tex);
+	game->tex = NULL;
+	game->textures.count = 0;
+}
@@ -1,78 +1,56 @@
 #include "cub3d.h"
 
-static int	load_texture(t_game *game, int idx, char *path)
-{
-	t_img	*tex;
-
-	tex = &game->texture[idx];
-	tex->ptr = mlx_xpm_file_to_image(game->mlx, path,
-			&tex->width, &tex->height);
-	if (!tex->ptr)
-		return (print_error("Failed to load texture"));
-	tex->addr = mlx_get_data_addr(tex->ptr, &tex->bpp,
-			&tex->line_len, &tex->endian);
-	if (!tex->addr)
-		return (print_error("Texture data error"));
-	return (0);
-}
-
 static int	create_frame(t_game *game)
 {
-	game->frame.ptr = mlx_new_image(game->mlx, WIN_WIDTH, WIN_HEIGHT);
+	game->frame.ptr = mlx_new_image(game->mlx, game->opts.width,
+			game->opts.height);
 	if (!game->frame.ptr)
 		return (print_error("Failed to create frame"));
 	game->frame.addr = mlx_get_data_addr(game->frame.ptr, &game->frame.bpp,
 			&game->frame.line_len, &game->frame.endian);
 	if (!game->frame.addr)
 		return (print_error("Frame data error"));
-	game->frame.width = WIN_WIDTH;
-	game->frame.height = WIN_HEIGHT;
+	game->frame.width = game->opts.width;
+	game->frame.height = game->opts.height;
 	return (0);
 }
 
 int	init_game(t_game *game)
 {
-	int	i;
-
+	if (init_dda_stats(game) || init_pmu(game))
+		return (1);
+	if (game->opts.headless)
+		return (init_headless(game));
 	ft_bzero(&game->input, sizeof(t_input));
 	game->mlx = mlx_init();
 	if (!game->mlx)
 		return (print_error("mlx_init failed"));
-	game->win = mlx_new_window(game->mlx, WIN_WIDTH, WIN_HEIGHT, "cub3D");
+	view_setup(game);
+	game->win = mlx_new_window(game->mlx, game->opts.width,
+			game->opts.height, "cub3D");
 	if (!game->win)
 		return (print_error("Failed to create window"));
-	if (create_frame(game))
+	if (create_frame(game) || init_textures(game))
 		return (1);
-	i = 0;
-	while (i < TEX_COUNT)
-	{
-		if (load_texture(game, i, game->config.texture[i]))
-			return (1);
-		i++;
-	}
+	pool_init(&game->pool, 0);
+	lightmap_build(game);
+	fog_build(game);
 	game->running = 1;
-	return (0);
-}
-
-static void	destroy_textures(t_game *game)
-{
-	int	i;
-
-	i = 0;
-	while (i < TEX_COUNT)
-	{
-		if (game->texture[i].ptr)
-			mlx_destroy_image(game->mlx, game->texture[i].ptr);
-		game->texture[i].ptr = NULL;
-		i++;
-	}
+	return (init_reload(game));
 }
 
 void	destroy_game(t_game *game)
 {
-	if (game->frame.ptr)
-		mlx_destroy_image(game->mlx, game->frame.ptr);
+	if (!game->opts.headless)
+		latency_print(&game->latency);
+	finish_reload(game);
+	trace_finish(game);
+	release_image(game, &game->frame);
 	destroy_textures(game);
+	free_lightmap(&game->light);
+	free_minimap(&game->minimap);
+	free_camera(&game->camera);
+	free_reproj(game);
 	if (game->win)
 		mlx_destroy_window(game->mlx, game->win);
 	if (game->mlx)
@@ -80,6 +58,10 @@ void	destroy_game(t_game *game)
 		mlx_destroy_display(game->mlx);
 		free(game->mlx);
 	}
+	pool_destroy(&game->pool);
+	free_entities(&game->entities);
+	finish_dda_stats(game);
+	finish_pmu(game);
 	free_map(&game->map);
 	free_config(&game->config);
 }
@@ -0,0 +1,57 @@
+#include "cub3d.h"
+
+static char	target_cell(t_game *game, int *x, int *y)
+{
+	double	reach;
+	char	c;
+
+	reach = 0.5;
+	while (reach <= 1.5)
+	{
+		*x = (int)(game->player.x + game->player.dir_x * reach);
+		*y = (int)(game->player.y + game->player.dir_y * reach);
+		c = map_cell(&game->map, *x, *y);
+		if (c != '0' && (*x != (int)game->player.x
+				|| *y != (int)game->player.y))
+			return (c);
+		reach += 0.5;
+	}
+	return ('0');
+}
+
+static int	world_break(t_game *game, int x, int y)
+{
+	if (game->map.shared)
+		return (0);
+	if (map_cell(&game->map, x - 1, y) == ' '
+		|| map_cell(&game->map, x + 1, y) == ' '
+		|| map_cell(&game->map, x, y - 1) == ' '
+		|| map_cell(&game->map, x, y + 1) == ' ')
+		return (0);
+	if (world_lock(game))
+		return (1);
+	map_set_cell(&game->map, x, y, '0');
+	world_cell_changed(game, x, y);
+	world_unlock(game);
+	return (0);
+}
+
+int	world_interact(t_game *game)
+{
+	t_door	*door;
+	int		x;
+	int		y;
+	char	c;
+
+	c = target_cell(game, &x, &y);
+	if (c == DOOR_CELL)
+	{
+		door = map_door(&game->map, map_cell_key(&game->map, x, y));
+		if (door)
+			door_toggle(&game->map, door);
+		return (0);
+	}
+	if (c > '0' && game->config.breakable[(unsigned char)c])
+		return (world_break(game, x, y));
+	return (0);
+}
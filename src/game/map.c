@@ -0,0 +1,58 @@
+#include "cub3d.h"
+
+char	map_cell(const t_map *map, int x, int y)
+{
+	if (x < 0 || y < 0 || x >= map->width || y >= map->height)
+		return (' ');
+	return (map->chunks[(long)(y >> CHUNK_SHIFT) * map->chunk_cols
+		+ (x >> CHUNK_SHIFT)][((y & CHUNK_MASK) << CHUNK_SHIFT)
+		| (x & CHUNK_MASK)]);
+}
+
+int	map_is_solid(const t_map *map, int x, int y)
+{
+	char	c;
+
+	c = map_cell(map, x, y);
+	if (c == DOOR_CELL)
+		return (map_door_blocks(map, x, y));
+	return (c != '0');
+}
+
+long	map_cell_key(const t_map *map, int x, int y)
+{
+	return ((((long)(y >> CHUNK_SHIFT) * map->chunk_cols
+				+ (x >> CHUNK_SHIFT)) << (CHUNK_SHIFT * 2))
+		| ((y & CHUNK_MASK) << CHUNK_SHIFT) | (x & CHUNK_MASK));
+}
+
+int	map_chunk_owned(const t_map *map, const char *chunk)
+{
+	if (chunk == map->void_chunk || chunk == map->solid_chunk)
+		return (0);
+	if (map->store && chunk >= map->store
+		&& chunk < map->store + map->store_size)
+		return (0);
+	return (1);
+}
+
+void	map_set_cell(t_map *map, int x, int y, char c)
+{
+	char	**chunk;
+	char	*copy;
+
+	if (x < 0 || y < 0 || x >= map->width || y >= map->height)
+		return ;
+	chunk = &map->chunks[(long)(y >> CHUNK_SHIFT) * map->chunk_cols
+		+ (x >> CHUNK_SHIFT)];
+	if (*chunk == map->void_chunk || *chunk == map->solid_chunk)
+	{
+		copy = safe_malloc(CHUNK_CELLS);
+		ft_memcpy(copy, *chunk, CHUNK_CELLS);
+		*chunk = copy;
+	}
+	if ((*chunk)[((y & CHUNK_MASK) << CHUNK_SHIFT) | (x & CHUNK_MASK)]
+		== DOOR_CELL || c == DOOR_CELL)
+		map_door_set(map, x, y, c == DOOR_CELL);
+	(*chunk)[((y & CHUNK_MASK) << CHUNK_SHIFT) | (x & CHUNK_MASK)] = c;
+}
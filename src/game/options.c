@@ -0,0 +1,91 @@
+#include "cub3d.h"
+
+static int	usage(void)
+{
+	return (print_error("Usage: ./cub3D <map.cub> [--record <trace>]"
+			" [--replay <trace> [--headless]]"
+			" [--render-batch <views.txt> <out_dir>]"
+			" [--dda-heatmap <out.ppm>] [--perf-counters <out.csv>]"
+			" [--watch] [--light-cache <file>]"
+			" [--resolution <W>x<H>] [--fov <degrees>] [--no-spans]"
+			" [--reproject <max_error_px>]"));
+}
+
+static int	take_value(int argc, char **argv, int *i, const char **dst)
+{
+	if (*i + 1 >= argc || *dst)
+		return (1);
+	*i += 1;
+	*dst = argv[*i];
+	return (0);
+}
+
+static const t_flag	g_flags[] = {
+{"--record", FLAG_PATH, offsetof(t_options, record_path)},
+{"--replay", FLAG_PATH, offsetof(t_options, replay_path)},
+{"--render-batch", FLAG_BATCH, offsetof(t_options, batch_views)},
+{"--dda-heatmap", FLAG_PATH, offsetof(t_options, heatmap_path)},
+{"--perf-counters", FLAG_PATH, offsetof(t_options, pmu_path)},
+{"--light-cache", FLAG_PATH, offsetof(t_options, light_cache)},
+{"--resolution", FLAG_RESOLUTION, 0},
+{"--fov", FLAG_FOV, 0},
+{"--reproject", FLAG_REPROJECT, 0},
+{"--headless", FLAG_SWITCH, offsetof(t_options, headless)},
+{"--watch", FLAG_SWITCH, offsetof(t_options, watch)},
+{"--no-spans", FLAG_SWITCH, offsetof(t_options, no_spans)},
+{NULL, 0, 0}};
+
+static int	parse_flag(t_options *opts, int argc, char **argv, int *i)
+{
+	const t_flag	*flag;
+	const char		*value;
+
+	flag = g_flags;
+	while (flag->name && ft_strncmp(argv[*i], flag->name,
+			ft_strlen(flag->name) + 1))
+		flag++;
+	if (!flag->name)
+		return (1);
+	if (flag->kind == FLAG_SWITCH)
+	{
+		*(int *)((char *)opts + flag->field) = 1;
+		return (0);
+	}
+	if (flag->kind == FLAG_BATCH)
+		opts->headless = 1;
+	if (flag->kind == FLAG_PATH || flag->kind == FLAG_BATCH)
+		return (take_value(argc, argv, i,
+				(const char **)((char *)opts + flag->field))
+			|| (flag->kind == FLAG_BATCH
+				&& take_value(argc, argv, i, &opts->batch_out)));
+	value = NULL;
+	if (take_value(argc, argv, i, &value))
+		return (1);
+	return (parse_view_flag(opts, flag->kind, value));
+}
+
+int	parse_options(t_options *opts, int argc, char **argv)
+{
+	int	i;
+
+	i = 1;
+	while (i < argc)
+	{
+		if (argv[i][0] == '-' && argv[i][1] == '-')
+		{
+			if (parse_flag(opts, argc, argv, &i))
+				return (usage());
+		}
+		else if (opts->map_path)
+			return (usage());
+		else
+			opts->map_path = argv[i];
+		i++;
+	}
+	if (!opts->map_path || (opts->record_path && opts->replay_path)
+		|| (opts->headless && !opts->replay_path && !opts->batch_views)
+		|| (opts->headless && opts->watch)
+		|| (opts->batch_views && (opts->record_path || opts->replay_path)))
+		return (usage());
+	return (0);
+}
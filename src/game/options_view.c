@@ -0,0 +1,45 @@
+#include "cub3d.h"
+
+static int	parse_resolution(t_options *opts, const char *value)
+{
+	char	*end;
+	long	w;
+	long	h;
+
+	if (opts->width > 0)
+		return (1);
+	w = strtol(value, &end, 10);
+	if (end == value || *end != 'x')
+		return (1);
+	value = end + 1;
+	h = strtol(value, &end, 10);
+	if (end == value || *end || w < WIN_MIN || w > WIN_MAX_W
+		|| h < WIN_MIN || h > WIN_MAX_H)
+		return (1);
+	opts->width = (int)w;
+	opts->height = (int)h;
+	return (0);
+}
+
+int	parse_view_flag(t_options *opts, int kind, const char *value)
+{
+	char	*end;
+	long	n;
+
+	if (kind == FLAG_RESOLUTION)
+		return (parse_resolution(opts, value));
+	if (kind == FLAG_FOV)
+	{
+		if (opts->fov > 0.0)
+			return (1);
+		opts->fov = strtod(value, &end);
+		return (end == value || *end || !(opts->fov >= FOV_MIN)
+			|| !(opts->fov <= FOV_MAX));
+	}
+	n = strtol(value, &end, 10);
+	if (opts->reproject || end == value || *end || n < 1
+		|| n > REPROJ_MAX_ERROR)
+		return (1);
+	opts->reproject = (int)n;
+	return (0);
+}
@@ -0,0 +1,82 @@
+#include "cub3d.h"
+
+static int	texture_slot(t_tex_table *table, const char *path)
+{
+	int	i;
+
+	i = 0;
+	while (i < table->count
+		&& ft_strncmp(table->path[i], path, ft_strlen(path) + 1))
+		i++;
+	if (i == table->count)
+		table->path[table->count++] = path;
+	return (i);
+}
+
+void	texture_table_build(t_tex_table *table, const t_config *cfg)
+{
+	const char	*path;
+	int			code;
+	int			face;
+
+	table->count = 0;
+	code = 0;
+	while (code < MAT_CODES)
+	{
+		face = 0;
+		while (face < TEX_COUNT)
+		{
+			path = cfg->texture[face];
+			if (cfg->mat_index[code])
+				path = cfg->mat[cfg->mat_index[code] - 1].face[face];
+			table->face[code * TEX_COUNT + face] = texture_slot(table, path);
+			face++;
+		}
+		code++;
+	}
+}
+
+void	texture_faces_bind(t_game *game)
+{
+	int	i;
+
+	i = 0;
+	while (i < MAT_CODES * TEX_COUNT)
+	{
+		game->face[i] = &game->tex[game->textures.face[i]];
+		i++;
+	}
+}
+
+static int	load_texture(t_game *game, t_img *tex, const char *path)
+{
+	if (!game->mlx)
+		return (load_texture_file(tex, path));
+	tex->ptr = mlx_xpm_file_to_image(game->mlx, (char *)path,
+			&tex->width, &tex->height);
+	if (!tex->ptr)
+		return (print_error("Failed to load texture"));
+	tex->addr = mlx_get_data_addr(tex->ptr, &tex->bpp,
+			&tex->line_len, &tex->endian);
+	if (!tex->addr)
+		return (print_error("Texture data error"));
+	return (0);
+}
+
+int	init_textures(t_game *game)
+{
+	int	i;
+
+	texture_table_build(&game->textures, &game->config);
+	game->tex = safe_malloc(sizeof(t_img) * game->textures.count);
+	ft_bzero(game->tex, sizeof(t_img) * game->textures.count);
+	i = 0;
+	while (i < game->textures.count)
+	{
+		if (load_texture(game, &game->tex[i], game->textures.path[i]))
+			return (1);
+		i++;
+	}
+	texture_faces_bind(game);
+	return (0);
+}
@@ -2,18 +2,7 @@
 
 static int	is_blocked(t_game *game, double x, double y)
 {
-	int	grid_x;
-	int	grid_y;
-
-	grid_x = (int)x;
-	grid_y = (int)y;
-	if (grid_x < 0 || grid_y < 0 || grid_x >= game->map.width
-		|| grid_y >= game->map.height)
-		return (1);
-	if (game->map.grid[grid_y][grid_x] == '1'
-		|| game->map.grid[grid_y][grid_x] == ' ')
-		return (1);
-	return (0);
+	return (map_is_solid(&game->map, (int)x, (int)y));
 }
 
 static void	move_player(t_game *game, double offset_x, double offset_y)
@@ -75,6 +64,12 @@ static void	apply_rotation(t_game *game)
 
 void	update_game_state(t_game *game)
 {
+	latency_consume(&game->latency);
 	update_position(game);
 	apply_rotation(game);
+	if (game->input.use && !world_interact(game))
+		game->input.use = 0;
+	if (game->map.doors.moving_count)
+		doors_tick(game);
+	entities_tick(&game->entities, &game->map, &game->pool, 1.0f);
 }
@@ -0,0 +1,35 @@
+#include "cub3d.h"
+
+int	world_lock(t_game *game)
+{
+	if (game->reload && pthread_mutex_trylock(&game->reload->lock))
+		return (1);
+	return (0);
+}
+
+void	world_unlock(t_game *game)
+{
+	if (game->reload)
+		pthread_mutex_unlock(&game->reload->lock);
+}
+
+int	world_track_flow(t_game *game, t_flow *flow)
+{
+	if (game->flow_count == FLOW_SLOTS)
+		return (-1);
+	game->flows[game->flow_count++] = flow;
+	return (0);
+}
+
+void	world_cell_changed(t_game *game, int x, int y)
+{
+	int	i;
+
+	i = 0;
+	while (i < game->flow_count)
+		flow_cell_changed(game->flows[i++], x, y);
+	minimap_touch(game, x, y);
+	reproj_invalidate(game);
+	if (!game->map.shared)
+		lightmap_patch(game, x, y);
+}
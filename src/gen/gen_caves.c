@@ -0,0 +1,50 @@
+#include "cub3d.h"
+
+static int	lattice(t_gen *gen, int x, int y, int shift)
+{
+	int	gx;
+	int	gy;
+	int	fx;
+	int	fy;
+	int	top;
+
+	gx = x >> shift;
+	gy = y >> shift;
+	fx = x & ((1 << shift) - 1);
+	fy = y & ((1 << shift) - 1);
+	top = (gen_hash(gen->seed + shift, gx, gy) & 0xFF) * ((1 << shift) - fx)
+		+ (gen_hash(gen->seed + shift, gx + 1, gy) & 0xFF) * fx;
+	return ((top * ((1 << shift) - fy)
+			+ ((gen_hash(gen->seed + shift, gx, gy + 1) & 0xFF)
+				* ((1 << shift) - fx)
+				+ (gen_hash(gen->seed + shift, gx + 1, gy + 1) & 0xFF) * fx)
+			* fy) >> (2 * shift));
+}
+
+static int	near_player(t_gen *gen, int x, int y)
+{
+	int	dx;
+	int	dy;
+
+	dx = x - gen->player_x;
+	dy = y - gen->player_y;
+	return (dx * dx + dy * dy <= 4);
+}
+
+void	gen_cave_row(t_gen *gen, int y)
+{
+	int	x;
+	int	noise;
+
+	ft_memset(gen->row, '1', gen->width);
+	if (y == 0 || y == gen->height - 1)
+		return ;
+	x = 1;
+	while (x < gen->width - 1)
+	{
+		noise = (lattice(gen, x, y, 4) * 2 + lattice(gen, x, y, 2)) / 3;
+		if (noise < 132 || near_player(gen, x, y))
+			gen->row[x] = '0';
+		x++;
+	}
+}
@@ -0,0 +1,78 @@
+#include "cub3d.h"
+
+static int	classify_line(char *line, size_t len)
+{
+	char	saved;
+	int		result;
+
+	saved = line[len];
+	line[len] = '\0';
+	result = 0;
+	if (!is_all_space(line))
+		result = 1 + is_map_line(line, NULL);
+	line[len] = saved;
+	return (result);
+}
+
+static size_t	header_end(char *data, size_t len)
+{
+	size_t	start;
+	size_t	end;
+	size_t	keep;
+	int		kind;
+
+	start = 0;
+	keep = 0;
+	while (start < len)
+	{
+		end = start;
+		while (end < len && data[end] != '\n')
+			end++;
+		kind = classify_line(data + start, end - start);
+		if (kind == 2)
+			break ;
+		if (kind == 1)
+			keep = end;
+		start = end + 1;
+	}
+	return (keep);
+}
+
+char	*gen_load_header(const char *path, size_t *len)
+{
+	char	*data;
+	char	*header;
+	size_t	size;
+
+	data = read_file(path, &size);
+	if (!data)
+		return (NULL);
+	*len = header_end(data, size);
+	header = safe_malloc(*len + 2);
+	ft_memcpy(header, data, *len);
+	free(data);
+	header[(*len)++] = '\n';
+	header[(*len)++] = '\n';
+	return (header);
+}
+
+unsigned int	gen_hash(unsigned int seed, int x, int y)
+{
+	unsigned int	h;
+
+	h = seed ^ ((unsigned int)x * 0x9E3779B1u) ^ ((unsigned int)y * 0x85EBCA77u);
+	h ^= h >> 16;
+	h *= 0x7FEB352Du;
+	h ^= h >> 15;
+	h *= 0x846CA68Bu;
+	h ^= h >> 16;
+	return (h);
+}
+
+unsigned int	gen_rand(t_gen *gen)
+{
+	gen->rng ^= gen->rng << 13;
+	gen->rng ^= gen->rng >> 17;
+	gen->rng ^= gen->rng << 5;
+	return (gen->rng);
+}
@@ -0,0 +1,93 @@
+#include "cub3d.h"
+
+int	gen_maze_init(t_gen *gen)
+{
+	int	c;
+
+	gen->cells = (gen->width - 1) / 2;
+	gen->set = safe_malloc(sizeof(int) * gen->cells * 4);
+	gen->parent = gen->set + gen->cells;
+	gen->remap = gen->parent + gen->cells;
+	gen->count = gen->remap + gen->cells;
+	gen->flags = ft_calloc(gen->cells * 3, 1);
+	gen->right = gen->flags + gen->cells;
+	gen->down = gen->right + gen->cells;
+	c = 0;
+	while (c < gen->cells)
+	{
+		gen->set[c] = c;
+		gen->parent[c] = c;
+		gen->remap[c] = -1;
+		gen->count[c] = 0;
+		c++;
+	}
+	return (0);
+}
+
+static int	find_root(int *parent, int id)
+{
+	while (parent[id] != id)
+	{
+		parent[id] = parent[parent[id]];
+		id = parent[id];
+	}
+	return (id);
+}
+
+static void	join_columns(t_gen *gen, int last)
+{
+	int	c;
+	int	a;
+	int	b;
+
+	c = 0;
+	while (c + 1 < gen->cells)
+	{
+		a = find_root(gen->parent, gen->set[c]);
+		b = find_root(gen->parent, gen->set[c + 1]);
+		gen->right[c] = 0;
+		if (a != b && (last || (gen_rand(gen) & 1)))
+		{
+			gen->parent[b] = a;
+			gen->right[c] = 1;
+		}
+		c++;
+	}
+	c = 0;
+	while (c < gen->cells)
+	{
+		gen->set[c] = find_root(gen->parent, gen->set[c]);
+		gen->count[gen->set[c]]++;
+		c++;
+	}
+}
+
+static void	pick_down(t_gen *gen)
+{
+	int	c;
+	int	root;
+
+	c = 0;
+	while (c < gen->cells)
+	{
+		root = gen->set[c];
+		gen->down[c] = gen_rand(gen) & 1;
+		if (gen->down[c])
+			gen->flags[root] = 1;
+		if (--gen->count[root] == 0 && !gen->flags[root])
+		{
+			gen->down[c] = 1;
+			gen->flags[root] = 1;
+		}
+		c++;
+	}
+}
+
+void	gen_maze_step(t_gen *gen, int last)
+{
+	join_columns(gen, last);
+	if (last)
+		return ;
+	pick_down(gen);
+	gen_maze_relabel(gen);
+}
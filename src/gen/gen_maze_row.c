@@ -0,0 +1,84 @@
+#include "cub3d.h"
+
+void	gen_maze_relabel(t_gen *gen)
+{
+	int	c;
+	int	next;
+
+	next = 0;
+	c = -1;
+	while (++c < gen->cells)
+		if (gen->down[c] && gen->remap[gen->set[c]] < 0)
+			gen->remap[gen->set[c]] = next++;
+	c = -1;
+	while (++c < gen->cells)
+	{
+		gen->flags[gen->set[c]] = 0;
+		if (gen->down[c])
+			gen->count[c] = gen->remap[gen->set[c]];
+		else
+			gen->count[c] = next++;
+	}
+	c = -1;
+	while (++c < gen->cells)
+	{
+		gen->remap[gen->set[c]] = -1;
+		gen->set[c] = gen->count[c];
+		gen->count[c] = 0;
+		gen->parent[c] = c;
+	}
+}
+
+static void	fill_cell_row(t_gen *gen)
+{
+	int	c;
+
+	c = 0;
+	while (c < gen->cells)
+	{
+		gen->row[2 * c + 1] = '0';
+		if (gen->right[c])
+			gen->row[2 * c + 2] = '0';
+		c++;
+	}
+}
+
+static void	fill_down_row(t_gen *gen)
+{
+	int	c;
+
+	c = 0;
+	while (c < gen->cells)
+	{
+		if (gen->down[c])
+			gen->row[2 * c + 1] = '0';
+		c++;
+	}
+}
+
+void	gen_maze_row(t_gen *gen, int y)
+{
+	int	r;
+	int	rows;
+
+	rows = (gen->height - 1) / 2;
+	r = (y - 1) / 2;
+	ft_memset(gen->row, '1', gen->width);
+	if (y <= 0 || r >= rows)
+		return ;
+	if (y % 2 == 1)
+	{
+		gen_maze_step(gen, r == rows - 1);
+		fill_cell_row(gen);
+	}
+	else if (r < rows - 1)
+		fill_down_row(gen);
+}
+
+void	gen_maze_free(t_gen *gen)
+{
+	free(gen->set);
+	free(gen->flags);
+	gen->set = NULL;
+	gen->flags = NULL;
+}
@@ -0,0 +1,44 @@
+#include "cub3d.h"
+
+static void	frame_row(t_gen *gen, int y)
+{
+	if (y == 0 || y == gen->height - 1)
+	{
+		ft_memset(gen->row, '1', gen->width);
+		return ;
+	}
+	ft_memset(gen->row, '0', gen->width);
+	gen->row[0] = '1';
+	gen->row[gen->width - 1] = '1';
+}
+
+void	gen_arena_row(t_gen *gen, int y)
+{
+	int	x;
+
+	frame_row(gen, y);
+	if (y == 0 || y == gen->height - 1 || y % 8 < 3 || y % 8 > 4)
+		return ;
+	x = 3;
+	while (x + 1 < gen->width - 1)
+	{
+		if (gen_hash(gen->seed, x / 8, y / 8) % 3 == 0)
+		{
+			gen->row[x] = '1';
+			gen->row[x + 1] = '1';
+		}
+		x += 8;
+	}
+}
+
+void	gen_corridor_row(t_gen *gen, int y)
+{
+	frame_row(gen, y);
+	if (y == 0 || y == gen->height - 1 || y % 2 == 1)
+		return ;
+	ft_memset(gen->row + 1, '1', gen->width - 2);
+	if ((y / 2) % 2 == 1)
+		gen->row[gen->width - 2] = '0';
+	else
+		gen->row[1] = '0';
+}
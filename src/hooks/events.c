@@ -1,6 +1,6 @@
 #include "cub3d.h"
 
-static void	set_movement_flag(t_input *input, int keycode, int value)
+int	set_movement_flag(t_input *input, int keycode, int value)
 {
 	if (keycode == KEY_W)
 		input->forward = value;
@@ -14,6 +14,11 @@ static void	set_movement_flag(t_input *input, int keycode, int value)
 		input->turn_left = value;
 	else if (keycode == KEY_RIGHT)
 		input->turn_right = value;
+	else if (keycode == KEY_E)
+		input->use |= value;
+	else
+		return (0);
+	return (1);
 }
 
 int	handle_key_press(int keycode, void *param)
@@ -23,7 +28,21 @@ int	handle_key_press(int keycode, void *param)
 	game = (t_game *)param;
 	if (keycode == KEY_ESC)
 		return (handle_close(param));
-	set_movement_flag(&game->input, keycode, 1);
+	if (keycode == KEY_H)
+	{
+		game->hud.visible = !game->hud.visible;
+		game->pool.timed = game->hud.visible;
+	}
+	if (keycode == KEY_M)
+	{
+		game->minimap.visible = !game->minimap.visible;
+		minimap_invalidate(game);
+	}
+	if (game->trace.mode == TRACE_REPLAY)
+		return (0);
+	trace_record_key(game, keycode, 1);
+	if (set_movement_flag(&game->input, keycode, 1))
+		latency_input(&game->latency, now_usec());
 	return (0);
 }
 
@@ -32,7 +51,11 @@ int	handle_key_release(int keycode, void *param)
 	t_game	*game;
 
 	game = (t_game *)param;
-	set_movement_flag(&game->input, keycode, 0);
+	if (game->trace.mode == TRACE_REPLAY)
+		return (0);
+	trace_record_key(game, keycode, 0);
+	if (set_movement_flag(&game->input, keycode, 0))
+		latency_input(&game->latency, now_usec());
 	return (0);
 }
 
@@ -54,7 +77,16 @@ int	game_loop(void *param)
 	game = (t_game *)param;
 	if (!game->running)
 		return (0);
+	if (game->reload)
+		reload_poll(game);
+	hud_frame(game, now_usec());
+	if (game->trace.mode == TRACE_REPLAY && trace_apply(game))
+		return (handle_close(param));
+	game->hud.stage_us[HUD_STAGE_UPDATE] = now_usec();
 	update_game_state(game);
+	game->hud.stage_us[HUD_STAGE_UPDATE] = now_usec()
+		- game->hud.stage_us[HUD_STAGE_UPDATE];
+	game->tick++;
 	render_frame(game);
 	return (0);
 }
@@ -23,24 +23,39 @@ static void	setup_hooks(t_game *game)
 	mlx_loop_hook(game->mlx, game_loop, game);
 }
 
+static int	start_trace(t_game *game)
+{
+	if (game->opts.replay_path)
+		return (trace_load(game, game->opts.replay_path));
+	if (game->opts.record_path)
+		return (trace_start_record(game, game->opts.record_path));
+	return (0);
+}
+
 int	main(int argc, char **argv)
 {
 	t_game	game;
+	int		status;
 
-	if (argc != 2)
-		return (print_error("Usage: ./cub3D <map.cub>"));
-	if (!check_extension(argv[1]))
-		return (print_error("Invalid file extension"));
 	init_game_struct(&game);
-	if (parse_scene(&game, argv[1]))
+	if (parse_options(&game.opts, argc, argv))
+		return (1);
+	if (!check_extension(game.opts.map_path))
+		return (print_error("Invalid file extension"));
+	if (parse_scene(&game, game.opts.map_path) || init_game(&game)
+		|| start_trace(&game))
 	{
 		destroy_game(&game);
 		return (1);
 	}
-	if (init_game(&game))
+	if (game.opts.headless)
 	{
+		if (game.opts.batch_views)
+			status = run_render_batch(&game);
+		else
+			status = run_headless_replay(&game);
 		destroy_game(&game);
-		return (1);
+		return (status);
 	}
 	setup_hooks(&game);
 	mlx_loop(game.mlx);
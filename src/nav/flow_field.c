@@ -0,0 +1,67 @@
+#include "cub3d.h"
+
+int	flow_init(t_flow *flow, const t_map *map, int radius)
+{
+	long	i;
+
+	ft_bzero(flow, sizeof(t_flow));
+	flow->map = map;
+	flow->width = map->width;
+	flow->height = map->height;
+	flow->radius = radius;
+	if (radius <= 0)
+		flow->radius = FLOW_INF - 1;
+	flow->dist = safe_malloc(sizeof(int) * (long)map->width * map->height);
+	i = 0;
+	while (i < (long)map->width * map->height)
+		flow->dist[i++] = FLOW_INF;
+	return (0);
+}
+
+void	free_flow(t_flow *flow)
+{
+	free(flow->dist);
+	free(flow->heap_key);
+	free(flow->heap_cell);
+	free(flow->stack);
+	free(flow->stack_dist);
+	ft_bzero(flow, sizeof(t_flow));
+}
+
+int	flow_passable(t_flow *flow, long cell)
+{
+	return (!map_is_solid(flow->map, (int)(cell % flow->width),
+		(int)(cell / flow->width)));
+}
+
+static void	relax_neighbor(t_flow *flow, long cell, int dist)
+{
+	if (!flow_passable(flow, cell) || dist >= flow->dist[cell]
+		|| dist > flow->radius)
+		return ;
+	flow->dist[cell] = dist;
+	flow->touched++;
+	flow_heap_push(flow, dist, cell);
+}
+
+void	flow_propagate(t_flow *flow)
+{
+	int		key;
+	long	cell;
+	int		x;
+
+	while (flow_heap_pop(flow, &key, &cell))
+	{
+		if (key != flow->dist[cell])
+			continue ;
+		x = (int)(cell % flow->width);
+		if (x > 0)
+			relax_neighbor(flow, cell - 1, key + 1);
+		if (x < flow->width - 1)
+			relax_neighbor(flow, cell + 1, key + 1);
+		if (cell >= flow->width)
+			relax_neighbor(flow, cell - flow->width, key + 1);
+		if (cell < (long)flow->width * (flow->height - 1))
+			relax_neighbor(flow, cell + flow->width, key + 1);
+	}
+}
@@ -0,0 +1,80 @@
+#include "cub3d.h"
+
+static void	heap_grow(t_flow *flow)
+{
+	int		*keys;
+	long	*cells;
+	int		capacity;
+
+	capacity = flow->heap_cap * 2;
+	if (capacity < 256)
+		capacity = 256;
+	keys = safe_malloc(sizeof(int) * capacity);
+	cells = safe_malloc(sizeof(long) * capacity);
+	if (flow->heap_len)
+	{
+		ft_memcpy(keys, flow->heap_key, sizeof(int) * flow->heap_len);
+		ft_memcpy(cells, flow->heap_cell, sizeof(long) * flow->heap_len);
+	}
+	free(flow->heap_key);
+	free(flow->heap_cell);
+	flow->heap_key = keys;
+	flow->heap_cell = cells;
+	flow->heap_cap = capacity;
+}
+
+static void	heap_swap(t_flow *flow, int a, int b)
+{
+	int		key;
+	long	cell;
+
+	key = flow->heap_key[a];
+	cell = flow->heap_cell[a];
+	flow->heap_key[a] = flow->heap_key[b];
+	flow->heap_cell[a] = flow->heap_cell[b];
+	flow->heap_key[b] = key;
+	flow->heap_cell[b] = cell;
+}
+
+void	flow_heap_push(t_flow *flow, int key, long cell)
+{
+	int	i;
+
+	if (flow->heap_len == flow->heap_cap)
+		heap_grow(flow);
+	i = flow->heap_len++;
+	flow->heap_key[i] = key;
+	flow->heap_cell[i] = cell;
+	while (i > 0 && flow->heap_key[(i - 1) / 2] > flow->heap_key[i])
+	{
+		heap_swap(flow, i, (i - 1) / 2);
+		i = (i - 1) / 2;
+	}
+}
+
+int	flow_heap_pop(t_flow *flow, int *key, long *cell)
+{
+	int	i;
+	int	child;
+
+	if (flow->heap_len == 0)
+		return (0);
+	*key = flow->heap_key[0];
+	*cell = flow->heap_cell[0];
+	flow->heap_len--;
+	heap_swap(flow, 0, flow->heap_len);
+	i = 0;
+	child = 1;
+	while (child < flow->heap_len)
+	{
+		if (child + 1 < flow->heap_len
+			&& flow->heap_key[child + 1] < flow->heap_key[child])
+			child++;
+		if (flow->heap_key[i] <= flow->heap_key[child])
+			break ;
+		heap_swap(flow, i, child);
+		i = child;
+		child = i * 2 + 1;
+	}
+	return (1);
+}
@@ -0,0 +1,44 @@
+#include "cub3d.h"
+
+static void	consider(t_flow *flow, long cell, int dir, int *best)
+{
+	if (flow->dist[cell] < best[0])
+	{
+		best[0] = flow->dist[cell];
+		best[1] = dir;
+	}
+}
+
+int	flow_distance(const t_flow *flow, int x, int y)
+{
+	if (x < 0 || y < 0 || x >= flow->width || y >= flow->height)
+		return (FLOW_INF);
+	return (flow->dist[(long)y * flow->width + x]);
+}
+
+int	flow_direction(t_flow *flow, int x, int y, int *step)
+{
+	long	cell;
+	int		best[2];
+
+	step[0] = 0;
+	step[1] = 0;
+	if (flow_distance(flow, x, y) == FLOW_INF)
+		return (-1);
+	cell = (long)y * flow->width + x;
+	best[0] = flow->dist[cell];
+	best[1] = -1;
+	if (x > 0)
+		consider(flow, cell - 1, 0, best);
+	if (x < flow->width - 1)
+		consider(flow, cell + 1, 1, best);
+	if (y > 0)
+		consider(flow, cell - flow->width, 2, best);
+	if (y < flow->height - 1)
+		consider(flow, cell + flow->width, 3, best);
+	if (best[1] == 0 || best[1] == 1)
+		step[0] = best[1] * 2 - 1;
+	if (best[1] == 2 || best[1] == 3)
+		step[1] = (best[1] - 2) * 2 - 1;
+	return (0);
+}
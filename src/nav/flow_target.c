@@ -0,0 +1,64 @@
+#include "cub3d.h"
+
+static long	flow_index(t_flow *flow, int x, int y)
+{
+	if (x < 0 || y < 0 || x >= flow->width || y >= flow->height)
+		return (-1);
+	return ((long)y * flow->width + x);
+}
+
+int	flow_add_target(t_flow *flow, int x, int y)
+{
+	long	cell;
+
+	cell = flow_index(flow, x, y);
+	if (cell < 0 || !flow_passable(flow, cell))
+		return (-1);
+	if (flow->dist[cell] == 0)
+		return (0);
+	flow->dist[cell] = 0;
+	flow->touched++;
+	flow_heap_push(flow, 0, cell);
+	flow_propagate(flow);
+	return (0);
+}
+
+int	flow_remove_target(t_flow *flow, int x, int y)
+{
+	long	cell;
+
+	cell = flow_index(flow, x, y);
+	if (cell < 0 || flow->dist[cell] != 0)
+		return (-1);
+	flow_invalidate(flow, cell);
+	return (0);
+}
+
+int	flow_move_target(t_flow *flow, int *from, int x, int y)
+{
+	if (from[0] == x && from[1] == y)
+		return (0);
+	if (flow_add_target(flow, x, y))
+		return (-1);
+	flow_remove_target(flow, from[0], from[1]);
+	from[0] = x;
+	from[1] = y;
+	return (0);
+}
+
+void	flow_cell_changed(t_flow *flow, int x, int y)
+{
+	long	cell;
+
+	cell = flow_index(flow, x, y);
+	if (cell < 0)
+		return ;
+	if (!flow_passable(flow, cell))
+	{
+		if (flow->dist[cell] != FLOW_INF)
+			flow_invalidate(flow, cell);
+		return ;
+	}
+	flow_reseed(flow, cell);
+	flow_propagate(flow);
+}
@@ -0,0 +1,93 @@
+#include "cub3d.h"
+
+static void	mark_invalid(t_flow *flow, long cell, int old_dist)
+{
+	long	*cells;
+	int		*dists;
+
+	if (flow->stack_len == flow->stack_cap)
+	{
+		flow->stack_cap = flow->stack_cap * 2 + 256;
+		cells = safe_malloc(sizeof(long) * flow->stack_cap);
+		dists = safe_malloc(sizeof(int) * flow->stack_cap);
+		ft_memcpy(cells, flow->stack, sizeof(long) * flow->stack_len);
+		ft_memcpy(dists, flow->stack_dist, sizeof(int) * flow->stack_len);
+		free(flow->stack);
+		free(flow->stack_dist);
+		flow->stack = cells;
+		flow->stack_dist = dists;
+	}
+	flow->stack[flow->stack_len] = cell;
+	flow->stack_dist[flow->stack_len++] = old_dist;
+	flow->dist[cell] = FLOW_INF;
+	flow->touched++;
+}
+
+static void	visit_child(t_flow *flow, long cell, int parent_dist)
+{
+	if (flow->dist[cell] != FLOW_INF && flow->dist[cell] == parent_dist + 1)
+		mark_invalid(flow, cell, parent_dist + 1);
+}
+
+static int	best_neighbor(t_flow *flow, long cell)
+{
+	int	best;
+	int	x;
+
+	best = FLOW_INF;
+	x = (int)(cell % flow->width);
+	if (x > 0 && flow->dist[cell - 1] < best)
+		best = flow->dist[cell - 1];
+	if (x < flow->width - 1 && flow->dist[cell + 1] < best)
+		best = flow->dist[cell + 1];
+	if (cell >= flow->width && flow->dist[cell - flow->width] < best)
+		best = flow->dist[cell - flow->width];
+	if (cell < (long)flow->width * (flow->height - 1)
+		&& flow->dist[cell + flow->width] < best)
+		best = flow->dist[cell + flow->width];
+	return (best);
+}
+
+void	flow_reseed(t_flow *flow, long cell)
+{
+	int	best;
+
+	if (!flow_passable(flow, cell))
+		return ;
+	best = best_neighbor(flow, cell);
+	if (best == FLOW_INF || best + 1 > flow->radius
+		|| best + 1 >= flow->dist[cell])
+		return ;
+	flow->dist[cell] = best + 1;
+	flow->touched++;
+	flow_heap_push(flow, best + 1, cell);
+}
+
+void	flow_invalidate(t_flow *flow, long cell)
+{
+	int		i;
+	long	c;
+	int		x;
+
+	flow->stack_len = 0;
+	mark_invalid(flow, cell, flow->dist[cell]);
+	i = 0;
+	while (i < flow->stack_len)
+	{
+		c = flow->stack[i];
+		x = (int)(c % flow->width);
+		if (x > 0)
+			visit_child(flow, c - 1, flow->stack_dist[i]);
+		if (x < flow->width - 1)
+			visit_child(flow, c + 1, flow->stack_dist[i]);
+		if (c >= flow->width)
+			visit_child(flow, c - flow->width, flow->stack_dist[i]);
+		if (c < (long)flow->width * (flow->height - 1))
+			visit_child(flow, c + flow->width, flow->stack_dist[i]);
+		i++;
+	}
+	i = 0;
+	while (i < flow->stack_len)
+		flow_reseed(flow, flow->stack[i++]);
+	flow_propagate(flow);
+}
@@ -0,0 +1,65 @@
+#include "cub3d.h"
+
+static void	trace_segment(const t_map *map, t_los_query *q)
+{
+	t_ray	ray;
+	double	length;
+	int		status;
+
+	length = hypot(q->to_x - q->from_x, q->to_y - q->from_y);
+	q->visible = 0;
+	q->hit_dist = 0.0;
+	if (map_is_solid(map, (int)floor(q->from_x), (int)floor(q->from_y)))
+		return ;
+	q->visible = 1;
+	q->hit_dist = length;
+	if (length == 0.0)
+		return ;
+	ray.dir_x = (q->to_x - q->from_x) / length;
+	ray.dir_y = (q->to_y - q->from_y) / length;
+	ray_prepare(&ray, q->from_x, q->from_y);
+	status = 0;
+	while (status == 0 && fmin(ray.side_dist_x, ray.side_dist_y) < length)
+		status = ray_advance_cell(map, &ray);
+	if (status == 0)
+		return ;
+	q->visible = 0;
+	q->hit_dist = ray.side_dist_y - ray.delta_dist_y;
+	if (ray.side == 0)
+		q->hit_dist = ray.side_dist_x - ray.delta_dist_x;
+}
+
+static void	los_range(void *ctx, int begin, int end)
+{
+	t_los	*los;
+
+	los = (t_los *)ctx;
+	while (begin < end)
+	{
+		trace_segment(los->map, &los->queries[los->order[begin]]);
+		begin++;
+	}
+}
+
+void	los_run(t_los *los, const t_map *map, t_los_query *queries, int count)
+{
+	if (count <= 0)
+		return ;
+	los->map = map;
+	los_sort_queries(los, queries, count);
+	los->queries = queries;
+	pool_run(los->pool, los_range, los, count);
+}
+
+void	free_los(t_los *los)
+{
+	free(los->keys);
+	free(los->tmp_keys);
+	free(los->order);
+	free(los->tmp_order);
+	los->keys = NULL;
+	los->tmp_keys = NULL;
+	los->order = NULL;
+	los->tmp_order = NULL;
+	los->capacity = 0;
+}
@@ -0,0 +1,85 @@
+#include "cub3d.h"
+
+static unsigned int	spread_bits(unsigned int v)
+{
+	v &= 0x7FFF;
+	v = (v | (v << 8)) & 0x00FF00FF;
+	v = (v | (v << 4)) & 0x0F0F0F0F;
+	v = (v | (v << 2)) & 0x33333333;
+	v = (v | (v << 1)) & 0x55555555;
+	return (v);
+}
+
+static unsigned int	query_key(const t_map *map, const t_los_query *q)
+{
+	unsigned int	octant;
+	double			x;
+	double			y;
+
+	x = fmin(fmax(floor(q->from_x), 0.0), map->width - 1);
+	y = fmin(fmax(floor(q->from_y), 0.0), map->height - 1);
+	octant = (q->to_x < q->from_x) | ((q->to_y < q->from_y) << 1);
+	return ((spread_bits((unsigned int)x) << 2)
+		| (spread_bits((unsigned int)y) << 3) | octant);
+}
+
+static void	radix_pass(t_los *los, int count, int shift)
+{
+	int				offset[257];
+	int				i;
+	unsigned int	digit;
+
+	ft_bzero(offset, sizeof(offset));
+	i = 0;
+	while (i < count)
+		offset[((los->keys[i++] >> shift) & 0xFF) + 1]++;
+	i = 0;
+	while (++i < 257)
+		offset[i] += offset[i - 1];
+	i = 0;
+	while (i < count)
+	{
+		digit = (los->keys[i] >> shift) & 0xFF;
+		los->tmp_keys[offset[digit]] = los->keys[i];
+		los->tmp_order[offset[digit]++] = los->order[i];
+		i++;
+	}
+	ft_memcpy(los->keys, los->tmp_keys, sizeof(unsigned int) * count);
+	ft_memcpy(los->order, los->tmp_order, sizeof(int) * count);
+}
+
+static void	los_reserve(t_los *los, int count)
+{
+	if (count <= los->capacity)
+		return ;
+	free(los->keys);
+	free(los->tmp_keys);
+	free(los->order);
+	free(los->tmp_order);
+	los->keys = safe_malloc(sizeof(unsigned int) * count);
+	los->tmp_keys = safe_malloc(sizeof(unsigned int) * count);
+	los->order = safe_malloc(sizeof(int) * count);
+	los->tmp_order = safe_malloc(sizeof(int) * count);
+	los->capacity = count;
+}
+
+void	los_sort_queries(t_los *los, const t_los_query *queries, int count)
+{
+	int	i;
+	int	shift;
+
+	los_reserve(los, count);
+	i = 0;
+	while (i < count)
+	{
+		los->keys[i] = query_key(los->map, &queries[i]);
+		los->order[i] = i;
+		i++;
+	}
+	shift = 0;
+	while (shift < 32)
+	{
+		radix_pass(los, count, shift);
+		shift += 8;
+	}
+}
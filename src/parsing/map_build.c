@@ -0,0 +1,82 @@
+#include "cub3d.h"
+
+static void	map_alloc_block(t_map_builder *b, t_map *map)
+{
+	size_t	table;
+
+	map->width = b->width;
+	map->height = b->rows;
+	map->chunk_cols = (b->width + CHUNK_SIZE - 1) / CHUNK_SIZE;
+	map->chunk_rows = b->band_total;
+	table = sizeof(char *) * (size_t)map->chunk_cols * map->chunk_rows;
+	map->chunks = safe_malloc(table + 2 * CHUNK_CELLS);
+	map->void_chunk = (char *)map->chunks + table;
+	map->solid_chunk = map->void_chunk + CHUNK_CELLS;
+	ft_memset(map->void_chunk, ' ', CHUNK_CELLS);
+	ft_memset(map->solid_chunk, '1', CHUNK_CELLS);
+}
+
+static char	*slot_chunk(t_map *map, long slot)
+{
+	if (slot == CHUNK_VOID)
+		return (map->void_chunk);
+	if (slot == CHUNK_SOLID)
+		return (map->solid_chunk);
+	return (map->store + slot * CHUNK_CELLS);
+}
+
+static int	map_store_chunks(t_map_builder *b, t_map *map)
+{
+	if (b->file_chunks == 0)
+		return (0);
+	map->store_size = (size_t)b->file_chunks * CHUNK_CELLS;
+	map->store = mmap(NULL, map->store_size, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE, b->fd, 0);
+	if (map->store == MAP_FAILED)
+	{
+		map->store = NULL;
+		map->store_size = 0;
+		return (print_error("Failed to map chunk store"));
+	}
+	return (0);
+}
+
+int	map_builder_build(t_map_builder *b, t_map *map)
+{
+	long	first;
+	int		band;
+	int		col;
+
+	if (map_store_chunks(b, map))
+		return (1);
+	map_alloc_block(b, map);
+	first = 0;
+	band = -1;
+	while (++band < b->band_total)
+	{
+		col = -1;
+		while (++col < map->chunk_cols)
+		{
+			map->chunks[(long)band * map->chunk_cols + col] = map->void_chunk;
+			if (col < b->band_cols[band])
+				map->chunks[(long)band * map->chunk_cols + col]
+					= slot_chunk(map, b->slots[first + col]);
+		}
+		first += b->band_cols[band];
+	}
+	map_builder_link_doors(b, map);
+	return (0);
+}
+
+void	map_builder_discard(t_map_builder *b)
+{
+	arena_free(&b->arena);
+	free(b->carry);
+	free(b->slots);
+	free(b->band_cols);
+	free(b->scratch);
+	free(b->doors);
+	if (b->fd >= 0)
+		close(b->fd);
+	map_builder_init(b);
+}
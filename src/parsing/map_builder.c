@@ -0,0 +1,83 @@
+#include "cub3d.h"
+
+void	map_builder_init(t_map_builder *b)
+{
+	ft_bzero(b, sizeof(t_map_builder));
+	b->fd = -1;
+}
+
+const char	*map_builder_row(t_map_builder *b, int y, int *len)
+{
+	*len = 0;
+	if (y >= b->band_first && y < b->band_first + b->band_count)
+	{
+		*len = b->band_len[y - b->band_first];
+		return (b->band[y - b->band_first]);
+	}
+	if (y >= 0 && y == b->band_first - 1 && b->carry)
+	{
+		*len = b->carry_len;
+		return (b->carry);
+	}
+	return (NULL);
+}
+
+static int	flush_band(t_map_builder *b)
+{
+	int	len;
+
+	if (!b->prev && map_builder_store_band(b))
+		return (print_error("Failed to write map chunks"));
+	len = b->band_len[b->band_count - 1];
+	if (len >= b->carry_cap)
+	{
+		free(b->carry);
+		b->carry_cap = len * 2 + 1;
+		b->carry = safe_malloc(b->carry_cap);
+	}
+	ft_memcpy(b->carry, b->band[b->band_count - 1], len + 1);
+	b->carry_len = len;
+	arena_reset(&b->arena);
+	b->band_first += b->band_count;
+	b->band_count = 0;
+	return (0);
+}
+
+int	map_builder_push(t_game *game, t_map_builder *b, char *line)
+{
+	int	len;
+	int	check;
+
+	len = ft_strlen(line);
+	b->cfg = &game->config;
+	if (claim_player(game, line, b->rows, &b->has_player))
+		return (1);
+	check = map_diff_check(b, line, len);
+	if (check < 0 || (b->rows > 0 && check
+			&& validate_map_row(b, b->rows - 1, line, len))
+		|| (b->band_count == CHUNK_SIZE && flush_band(b)))
+		return (1);
+	b->band[b->band_count] = arena_strndup(&b->arena, line, len);
+	b->band_len[b->band_count++] = len;
+	b->rows++;
+	if (len > b->width)
+		b->width = len;
+	return (0);
+}
+
+int	map_builder_finish(t_game *game, t_map_builder *b)
+{
+	if (b->rows <= 0)
+		return (print_error("Map section is empty"));
+	if (b->width == 0)
+		return (print_error("Map width is zero"));
+	if (b->prev)
+		return (map_diff_finish(game, b));
+	if (validate_map_row(b, b->rows - 1, NULL, 0))
+		return (1);
+	if (!b->has_player)
+		return (print_error("Missing player start"));
+	if (flush_band(b))
+		return (1);
+	return (map_builder_build(b, &game->map));
+}
@@ -0,0 +1,114 @@
+#include "cub3d.h"
+
+static long	fill_chunk(t_map_builder *b, int col, char *chunk)
+{
+	int		row;
+	int		x;
+	int		kind;
+	char	c;
+
+	kind = 0;
+	row = -1;
+	while (++row < CHUNK_SIZE)
+	{
+		x = -1;
+		while (++x < CHUNK_SIZE)
+		{
+			c = ' ';
+			if (row < b->band_count && col * CHUNK_SIZE + x < b->band_len[row])
+				c = b->band[row][col * CHUNK_SIZE + x];
+			chunk[(row << CHUNK_SHIFT) | x] = c;
+			kind |= (c != ' ') | ((c != '1') << 1) | ((c == DOOR_CELL) << 2);
+		}
+	}
+	if (!(kind & 1))
+		return (CHUNK_VOID);
+	if (!(kind & 2))
+		return (CHUNK_SOLID);
+	return (kind >> 2);
+}
+
+static void	*grow_block(void *old, size_t used, size_t size)
+{
+	void	*block;
+
+	block = safe_malloc(size);
+	ft_memcpy(block, old, used);
+	free(old);
+	return (block);
+}
+
+static int	reserve_band(t_map_builder *b)
+{
+	int	width;
+	int	cols;
+
+	width = 0;
+	cols = -1;
+	while (++cols < b->band_count)
+		if (b->band_len[cols] > width)
+			width = b->band_len[cols];
+	cols = (width + CHUNK_SIZE - 1) / CHUNK_SIZE;
+	if (b->slot_count + cols > b->slot_cap)
+	{
+		b->slot_cap = (b->slot_count + cols) * 2;
+		b->slots = grow_block(b->slots, sizeof(long) * b->slot_count,
+				sizeof(long) * b->slot_cap);
+	}
+	if (b->band_total == b->band_cap)
+	{
+		b->band_cap = b->band_cap * 2 + 16;
+		b->band_cols = grow_block(b->band_cols, sizeof(int) * b->band_total,
+				sizeof(int) * b->band_cap);
+	}
+	return (cols);
+}
+
+static int	write_chunks(t_map_builder *b, long count)
+{
+	char	path[32];
+
+	if (count == 0)
+		return (0);
+	if (b->fd < 0)
+	{
+		ft_memcpy(path, "/tmp/cub3d-chunks-XXXXXX", 25);
+		b->fd = mkstemp(path);
+		if (b->fd < 0)
+			return (-1);
+		unlink(path);
+	}
+	if (write_all(b->fd, b->scratch, (size_t)count * CHUNK_CELLS))
+		return (-1);
+	b->file_chunks += count;
+	return (0);
+}
+
+int	map_builder_store_band(t_map_builder *b)
+{
+	int		cols;
+	int		col;
+	long	mixed;
+	long	kind;
+
+	cols = reserve_band(b);
+	if (cols + 1 > b->scratch_cols)
+	{
+		free(b->scratch);
+		b->scratch_cols = (cols + 1) * 2;
+		b->scratch = safe_malloc((size_t)b->scratch_cols * CHUNK_CELLS);
+	}
+	b->band_cols[b->band_total++] = cols;
+	mixed = 0;
+	col = -1;
+	while (++col < cols)
+	{
+		kind = fill_chunk(b, col, b->scratch + mixed * CHUNK_CELLS);
+		if (kind == 1)
+			map_builder_chunk_doors(b, col);
+		if (kind >= 0)
+			kind = b->file_chunks + mixed++;
+		b->slots[b->slot_count++] = kind;
+	}
+	return (write_chunks(b, mixed));
+}
@@ -0,0 +1,76 @@
+#include "cub3d.h"
+
+static void	push_edit(t_map_patch *patch, int x, int y, char c)
+{
+	t_cell_edit	*cells;
+
+	if (patch->count == patch->cap)
+	{
+		patch->cap = patch->cap * 2 + 64;
+		cells = safe_malloc(sizeof(t_cell_edit) * patch->cap);
+		ft_memcpy(cells, patch->cells, sizeof(t_cell_edit) * patch->count);
+		free(patch->cells);
+		patch->cells = cells;
+	}
+	patch->cells[patch->count].x = x;
+	patch->cells[patch->count].y = y;
+	patch->cells[patch->count++].c = c;
+}
+
+static int	diff_row(t_map_builder *b, const char *line, int len)
+{
+	int		x;
+	int		changed;
+	char	c;
+
+	changed = 0;
+	x = 0;
+	while (x < b->prev->width)
+	{
+		c = ' ';
+		if (x < len)
+			c = line[x];
+		if (c != map_cell(b->prev, x, b->rows))
+		{
+			push_edit(b->patch, x, b->rows, c);
+			changed = 1;
+		}
+		x++;
+	}
+	return (changed);
+}
+
+int	map_diff_check(t_map_builder *b, const char *line, int len)
+{
+	if (!b->prev)
+		return (1);
+	if (b->rows >= b->prev->height || len > b->prev->width)
+	{
+		b->patch->reshaped = 1;
+		return (-1);
+	}
+	b->recent = ((b->recent << 1) | diff_row(b, line, len)) & 7;
+	if (b->rows > 0 && b->recent)
+		b->patch->rows_checked++;
+	return (b->recent != 0);
+}
+
+int	map_diff_finish(t_game *game, t_map_builder *b)
+{
+	if (b->rows != b->prev->height || b->width != b->prev->width)
+	{
+		b->patch->reshaped = 1;
+		return (1);
+	}
+	if (b->recent & 3)
+	{
+		b->patch->rows_checked++;
+		if (validate_map_row(b, b->rows - 1, NULL, 0))
+			return (1);
+	}
+	if (!b->has_player)
+		return (print_error("Missing player start"));
+	game->map.width = b->width;
+	game->map.height = b->rows;
+	return (0);
+}
@@ -0,0 +1,44 @@
+#include "cub3d.h"
+
+static void	push_door(t_map_builder *b, int x, int y)
+{
+	long	*doors;
+
+	if (b->door_count == b->door_cap)
+	{
+		b->door_cap = b->door_cap * 2 + 16;
+		doors = safe_malloc(sizeof(long) * b->door_cap);
+		ft_memcpy(doors, b->doors, sizeof(long) * b->door_count);
+		free(b->doors);
+		b->doors = doors;
+	}
+	b->doors[b->door_count++] = ((long)y << 32) | x;
+}
+
+void	map_builder_chunk_doors(t_map_builder *b, int col)
+{
+	int	row;
+	int	x;
+
+	row = -1;
+	while (++row < b->band_count)
+	{
+		x = col * CHUNK_SIZE - 1;
+		while (++x < (col + 1) * CHUNK_SIZE && x < b->band_len[row])
+			if (b->band[row][x] == DOOR_CELL)
+				push_door(b, x, b->band_first + row);
+	}
+}
+
+void	map_builder_link_doors(t_map_builder *b, t_map *map)
+{
+	long	i;
+
+	i = 0;
+	while (i < b->door_count)
+	{
+		map_door_set(map, (int)(b->doors[i] & 0xFFFFFFFF),
+			(int)(b->doors[i] >> 32), 1);
+		i++;
+	}
+}
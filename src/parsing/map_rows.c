@@ -0,0 +1,41 @@
+#include "cub3d.h"
+
+static char	row_char(t_row_window *win, int row, int x)
+{
+	if (!win->row[row] || x < 0 || x >= win->len[row])
+		return (' ');
+	return (win->row[row][x]);
+}
+
+static int	check_floor(t_row_window *win, int x, int y)
+{
+	if (x == 0 || y == 0 || !win->row[2])
+		return (print_error("Map not enclosed by walls"));
+	if (row_char(win, 0, x) == ' ' || row_char(win, 2, x) == ' '
+		|| row_char(win, 1, x - 1) == ' ' || row_char(win, 1, x + 1) == ' ')
+		return (print_error("Map has open space"));
+	return (0);
+}
+
+int	validate_map_row(t_map_builder *b, int y, const char *below, int below_len)
+{
+	t_row_window	win;
+	int				x;
+	char			c;
+
+	win.row[0] = map_builder_row(b, y - 1, &win.len[0]);
+	win.row[1] = map_builder_row(b, y, &win.len[1]);
+	win.row[2] = below;
+	win.len[2] = below_len;
+	x = 0;
+	while (x < win.len[1])
+	{
+		c = win.row[1][x];
+		if (c != '0' && c != ' ' && !scene_wall_code(b->cfg, c))
+			return (print_error("Invalid character in map"));
+		if ((c == '0' || c == DOOR_CELL) && check_floor(&win, x, y))
+			return (1);
+		x++;
+	}
+	return (0);
+}
@@ -2,24 +2,23 @@
 
 static int	parse_component(const char *line, int *index, int *value)
 {
-	int		start;
-	char	*fragment;
-	int		val;
+	int	start;
+	int	val;
 
 	while (line[*index] && ft_is_space(line[*index]))
 		(*index)++;
 	start = *index;
+	val = 0;
 	while (line[*index] && ft_is_digit(line[*index]))
+	{
+		if (val <= 255)
+			val = val * 10 + line[*index] - '0';
 		(*index)++;
+	}
 	if (start == *index)
 		return (print_error("Invalid color value"));
-	fragment = ft_strndup(line + start, *index - start);
-	if (ft_atoi_strict(fragment, &val) || val < 0 || val > 255)
-	{
-		free(fragment);
+	if (val > 255)
 		return (print_error("Color out of range"));
-	}
-	free(fragment);
 	while (line[*index] && ft_is_space(line[*index]))
 		(*index)++;
 	*value = val;
@@ -53,7 +52,7 @@ static int	require_comma(const char *line, int *index)
 	return (0);
 }
 
-static int	parse_rgb_values(const char *line, int *idx, t_color *color)
+int	parse_rgb_values(const char *line, int *idx, t_color *color)
 {
 	if (parse_component(line, idx, &color->r))
 		return (-1);
@@ -0,0 +1,59 @@
+#include "cub3d.h"
+
+static int	parse_number(char **line, double *out)
+{
+	char	*end;
+
+	while (**line && ft_is_space(**line))
+		(*line)++;
+	if (!ft_is_digit(**line) && **line != '.' && **line != '-')
+		return (1);
+	*out = strtod(*line, &end);
+	if (end == *line || (*end && !ft_is_space(*end)) || !isfinite(*out))
+		return (1);
+	*line = end;
+	return (0);
+}
+
+int	parse_light_line(t_config *cfg, char *line)
+{
+	t_light	light;
+
+	if (ft_strncmp(line, "LIGHT", 5) || !ft_is_space(line[5]))
+		return (1);
+	line += 5;
+	if (parse_number(&line, &light.x) || parse_number(&line, &light.y)
+		|| parse_number(&line, &light.intensity)
+		|| parse_number(&line, &light.radius))
+		return (-print_error("Light needs <x> <y> <intensity> <radius>"));
+	while (*line && ft_is_space(*line))
+		line++;
+	if (*line)
+		return (-print_error("Light needs <x> <y> <intensity> <radius>"));
+	if (light.intensity < 0.0 || light.radius <= 0.0)
+		return (-print_error("Invalid light intensity or radius"));
+	if (cfg->light_count == LIGHT_MAX)
+		return (-print_error("Too many lights"));
+	cfg->light[cfg->light_count++] = light;
+	return (0);
+}
+
+int	parse_fog_line(t_config *cfg, char *line)
+{
+	int	idx;
+
+	if (ft_strncmp(line, "FOG", 3) || !ft_is_space(line[3]))
+		return (1);
+	line += 3;
+	if (parse_number(&line, &cfg->fog_dist) || cfg->fog_dist <= 0.0)
+		return (-print_error("Fog needs <distance> <R,G,B>"));
+	if (cfg->fog_set)
+		return (-print_error("Duplicate fog entry"));
+	idx = 0;
+	if (parse_rgb_values(line, &idx, &cfg->fog))
+		return (-1);
+	if (line[idx])
+		return (-print_error("Trailing characters in color"));
+	cfg->fog_set = 1;
+	return (0);
+}
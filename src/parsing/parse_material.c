@@ -0,0 +1,92 @@
+#include "cub3d.h"
+
+static int	mat_code_ok(char c)
+{
+	if (c >= '2' && c <= '9')
+		return (1);
+	if (c == 'N' || c == 'S' || c == 'E' || c == 'W')
+		return (0);
+	return ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z'));
+}
+
+static int	split_words(char *line, char **word, int max)
+{
+	int	count;
+
+	count = 0;
+	while (*line)
+	{
+		while (*line && ft_is_space(*line))
+			*line++ = '\0';
+		if (!*line)
+			break ;
+		if (count == max)
+			return (max + 1);
+		word[count++] = line;
+		while (*line && !ft_is_space(*line))
+			line++;
+	}
+	return (count);
+}
+
+static int	store_material(t_config *cfg, char code, char **path, int count)
+{
+	t_material	*mat;
+	int			i;
+
+	if (cfg->mat_index[(unsigned char)code])
+		return (print_error("Duplicate material entry"));
+	if (cfg->mat_count == MAT_MAX)
+		return (print_error("Too many materials"));
+	mat = &cfg->mat[cfg->mat_count++];
+	mat->code = code;
+	cfg->mat_index[(unsigned char)code] = cfg->mat_count;
+	i = 0;
+	while (i < TEX_COUNT)
+	{
+		mat->face[i] = ft_strdup(path[i * (count == TEX_COUNT)]);
+		if (!mat->face[i])
+			return (print_error("Allocation failed"));
+		i++;
+	}
+	return (0);
+}
+
+int	parse_material_line(t_config *cfg, char *line)
+{
+	char	*word[TEX_COUNT + 1];
+	int		count;
+
+	if (ft_strncmp(line, "MAT", 3) || !ft_is_space(line[3]))
+		return (1);
+	count = split_words(line + 3, word, TEX_COUNT + 1);
+	if (count < 2)
+		return (-print_error("Missing material path"));
+	if (word[0][1] || !mat_code_ok(word[0][0]))
+		return (-print_error("Invalid material code"));
+	if (count != 2 && count != TEX_COUNT + 1)
+		return (-print_error("Material needs one or four texture paths"));
+	if (store_material(cfg, word[0][0], word + 1, count - 1))
+		return (-1);
+	return (0);
+}
+
+int	parse_break_line(t_config *cfg, char *line)
+{
+	if (ft_strncmp(line, "BREAK", 5) || !ft_is_space(line[5]))
+		return (1);
+	line += 5;
+	while (*line && ft_is_space(*line))
+		line++;
+	if (*line == '\0')
+		return (-print_error("Missing breakable codes"));
+	while (*line)
+	{
+		if (!ft_is_space(*line) && *line != '1' && !mat_code_ok(*line))
+			return (-print_error("Invalid breakable code"));
+		if (!ft_is_space(*line))
+			cfg->breakable[(unsigned char)*line] = 1;
+		line++;
+	}
+	return (0);
+}
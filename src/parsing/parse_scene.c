@@ -1,92 +1,79 @@
 #include "cub3d.h"
 
-static int	handle_config_line(t_game *game, char **line,
-			char ***map_lines, int *map_started)
+static int	handle_config_line(t_game *game, char *line,
+			t_map_builder *builder)
 {
-	if (*map_started || is_map_line(*line))
+	if (builder->rows > 0 || (!scene_header_key(line)
+			&& is_map_line(line, &game->config)))
 	{
 		if (!scene_config_ready(&game->config))
 			return (print_error("Map before textures/colors"));
-		if (is_all_space(*line))
+		if (is_all_space(line))
 			return (print_error("Empty line inside map"));
-		*map_started = 1;
-		arr_push(map_lines, &game->map.height, *line);
-		*line = NULL;
+		if (map_builder_push(game, builder, line))
+			return (-2);
 		return (0);
 	}
-	return (scene_process_entry(game, *line));
+	return (scene_process_entry(game, line));
 }
 
-static int	read_config_and_map(int fd, t_game *game,
-			char ***map_lines, int *map_started)
+static int	read_config_and_map(t_reader *rd, t_game *game,
+			t_map_builder *builder)
 {
 	int		status;
+	int		err;
 	char	*line;
 
-	while ((status = read_line(fd, &line)) >= 0)
+	while ((status = read_line(rd, &line)) > 0)
 	{
-		if (status == 0)
-		{
-			free(line);
-			break ;
-		}
-		if (handle_config_line(game, &line, map_lines, map_started))
-		{
-			free(line);
+		err = handle_config_line(game, line, builder);
+		if (err == -2)
+			return (-2);
+		if (err)
 			return (-1);
-		}
-		if (line)
-			free(line);
 	}
 	return (status);
 }
 
 static int	load_scene_lines(const char *path, t_game *game,
-			char ***map_lines, int *map_started)
+			t_map_builder *builder)
 {
-	int		status;
-	int		fd;
+	t_reader	rd;
+	int			status;
 
-	fd = open(path, O_RDONLY);
-	if (fd < 0)
+	ft_bzero(&rd, sizeof(t_reader));
+	rd.fd = open(path, O_RDONLY);
+	if (rd.fd < 0)
 		return (print_error("Unable to open .cub file"));
-	status = read_config_and_map(fd, game, map_lines, map_started);
-	close(fd);
+	status = read_config_and_map(&rd, game, builder);
+	close(rd.fd);
+	free(rd.line);
+	if (status == -2)
+		return (1);
 	if (status < 0)
-	{
-		free_str_array(*map_lines);
 		return (print_error("Failed to read file"));
-	}
 	return (0);
 }
 
-static int	finalize_scene_data(t_game *game, char **map_lines, int map_started)
+int	parse_scene_into(t_game *game, const char *path, t_map_builder *builder)
 {
-	if (!map_started)
-	{
-		free_str_array(map_lines);
-		return (print_error("Missing map section"));
-	}
-	if (finalize_map(&game->map, map_lines, game->map.height))
-	{
-		free_str_array(map_lines);
-		return (1);
-	}
-	free(map_lines);
-	if (validate_scene(game))
-		return (1);
-	return (0);
+	int	status;
+
+	status = load_scene_lines(path, game, builder);
+	if (status == 0 && builder->rows == 0)
+		status = print_error("Missing map section");
+	if (status == 0)
+		status = map_builder_finish(game, builder);
+	if (status == 0)
+		status = validate_scene(game, builder);
+	map_builder_discard(builder);
+	return (status);
 }
 
 int	parse_scene(t_game *game, const char *path)
 {
-	char	**map_lines;
-	int		map_started;
+	t_map_builder	builder;
 
-	map_lines = NULL;
-	map_started = 0;
-	game->map.height = 0;
-	if (load_scene_lines(path, game, &map_lines, &map_started))
-		return (1);
-	return (finalize_scene_data(game, map_lines, map_started));
+	map_builder_init(&builder);
+	return (parse_scene_into(game, path, &builder));
 }
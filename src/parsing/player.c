@@ -1,19 +1,19 @@
 #include "cub3d.h"
 
-static void	set_orientation(t_player *player, char dir)
+void	set_orientation(t_player *player, char dir)
 {
 	if (dir == 'N')
 	{
 		player->dir_x = 0;
 		player->dir_y = -1;
-		player->plane_x = 0.66;
+		player->plane_x = PLANE_DEFAULT;
 		player->plane_y = 0;
 	}
 	else if (dir == 'S')
 	{
 		player->dir_x = 0;
 		player->dir_y = 1;
-		player->plane_x = -0.66;
+		player->plane_x = -PLANE_DEFAULT;
 		player->plane_y = 0;
 	}
 	else if (dir == 'E')
@@ -21,58 +21,35 @@ static void	set_orientation(t_player *player, char dir)
 		player->dir_x = 1;
 		player->dir_y = 0;
 		player->plane_x = 0;
-		player->plane_y = 0.66;
+		player->plane_y = PLANE_DEFAULT;
 	}
 	else if (dir == 'W')
 	{
 		player->dir_x = -1;
 		player->dir_y = 0;
 		player->plane_x = 0;
-		player->plane_y = -0.66;
+		player->plane_y = -PLANE_DEFAULT;
 	}
 }
 
-static int	handle_cell(t_game *game, int x, int y, int *has_player)
-{
-	char	c;
-
-	c = game->map.grid[y][x];
-	if (c == '0' || c == '1' || c == ' ')
-		return (0);
-	if (c == 'N' || c == 'S' || c == 'E' || c == 'W')
-	{
-		if (*has_player)
-			return (print_error("Multiple player positions"));
-		*has_player = 1;
-		game->player.x = x + 0.5;
-		game->player.y = y + 0.5;
-		set_orientation(&game->player, c);
-		game->map.grid[y][x] = '0';
-		return (0);
-	}
-	return (print_error("Invalid character in map"));
-}
-
-int	setup_player(t_game *game)
+int	claim_player(t_game *game, char *row, int y, int *has_player)
 {
 	int	x;
-	int	y;
-	int	has_player;
 
-	has_player = 0;
-	y = 0;
-	while (y < game->map.height)
+	x = 0;
+	while (row[x])
 	{
-		x = 0;
-		while (x < game->map.width)
+		if (row[x] == 'N' || row[x] == 'S' || row[x] == 'E' || row[x] == 'W')
 		{
-			if (handle_cell(game, x, y, &has_player))
-				return (1);
-			x++;
+			if (*has_player)
+				return (print_error("Multiple player positions"));
+			*has_player = 1;
+			game->player.x = x + 0.5;
+			game->player.y = y + 0.5;
+			set_orientation(&game->player, row[x]);
+			row[x] = '0';
 		}
-		y++;
+		x++;
 	}
-	if (!has_player)
-		return (print_error("Missing player start"));
 	return (0);
 }
@@ -1,5 +1,8 @@
 #include "cub3d.h"
 
+static const char	*g_scene_keys[] = {"NO", "SO", "WE", "EA", "F", "C",
+	"MAT", "BREAK", "LIGHT", "FOG", NULL};
+
 int	scene_config_ready(t_config *cfg)
 {
 	int	i;
@@ -26,6 +29,17 @@ static int	save_trimmed_config(t_game *game, char *trimmed)
 	if (status == 0)
 		return (0);
 	status = parse_color_line(&game->config, trimmed);
+	if (status == -1)
+		return (1);
+	if (status == 0)
+		return (0);
+	status = parse_material_line(&game->config, trimmed);
+	if (status == 1)
+		status = parse_break_line(&game->config, trimmed);
+	if (status == 1)
+		status = parse_light_line(&game->config, trimmed);
+	if (status == 1)
+		status = parse_fog_line(&game->config, trimmed);
 	if (status == -1)
 		return (1);
 	if (status == 0)
@@ -33,21 +47,37 @@ static int	save_trimmed_config(t_game *game, char *trimmed)
 	return (print_error("Invalid configuration entry"));
 }
 
-int	scene_process_entry(t_game *game, char *raw)
+int	scene_process_entry(t_game *game, char *line)
 {
-	char	*trimmed;
-	int		result;
-
-	trimmed = ft_strdup(raw);
-	if (!trimmed)
-		return (print_error("Allocation failed"));
-	trim_spaces(trimmed);
-	if (trimmed[0] == '\0')
-	{
-		free(trimmed);
+	trim_spaces(line);
+	if (line[0] == '\0')
 		return (0);
+	return (save_trimmed_config(game, line));
+}
+
+int	scene_wall_code(const t_config *cfg, char c)
+{
+	if ((c >= '1' && c <= '9') || c == DOOR_CELL)
+		return (1);
+	return (cfg && (unsigned char)c < MAT_CODES
+		&& cfg->mat_index[(unsigned char)c]);
+}
+
+int	scene_header_key(const char *line)
+{
+	int		len;
+	int		i;
+
+	while (*line && ft_is_space(*line))
+		line++;
+	i = 0;
+	while (g_scene_keys[i])
+	{
+		len = ft_strlen(g_scene_keys[i]);
+		if (!ft_strncmp(line, g_scene_keys[i], len)
+			&& ft_is_space(line[len]))
+			return (1);
+		i++;
 	}
-	result = save_trimmed_config(game, trimmed);
-	free(trimmed);
-	return (result);
+	return (0);
 }
@@ -1,62 +1,57 @@
 #include "cub3d.h"
 
-static int	check_neighbors(t_map *map, int x, int y)
+static int	validate_config(t_config *cfg)
 {
-	if (x == 0 || y == 0 || x == map->width - 1 || y == map->height - 1)
-		return (print_error("Map not enclosed by walls"));
-	if (map->grid[y - 1][x] == ' ' || map->grid[y + 1][x] == ' '
-		|| map->grid[y][x - 1] == ' ' || map->grid[y][x + 1] == ' ')
-		return (print_error("Map has open space"));
+	int	i;
+
+	if (!cfg->floor_set || !cfg->ceiling_set)
+		return (print_error("Missing floor or ceiling color"));
+	i = 0;
+	while (i < TEX_COUNT)
+	{
+		if (!cfg->has_texture[i])
+			return (print_error("Missing texture definition"));
+		i++;
+	}
 	return (0);
 }
 
-static int	check_map_cells(t_map *map)
+static char	light_cell(const t_game *game, const t_map_builder *b,
+			int x, int y)
 {
-	int	x;
-	int	y;
-	char	c;
+	long	i;
 
-	y = 0;
-	while (y < map->height)
-	{
-		x = 0;
-		while (x < map->width)
-		{
-			c = map->grid[y][x];
-			if (c != '0' && c != '1' && c != ' ')
-				return (print_error("Invalid character in map"));
-			if (c == '0' && check_neighbors(map, x, y))
-				return (1);
-			x++;
-		}
-		y++;
-	}
-	return (0);
+	if (game->map.chunks || !b->patch)
+		return (map_cell(&game->map, x, y));
+	i = b->patch->count;
+	while (i-- > 0)
+		if (b->patch->cells[i].x == x && b->patch->cells[i].y == y)
+			return (b->patch->cells[i].c);
+	return (map_cell(b->prev, x, y));
 }
 
-static int	validate_config(t_config *cfg)
+static int	validate_lights(const t_game *game, const t_map_builder *b)
 {
-	int	i;
+	const t_light	*light;
+	int				i;
 
-	if (!cfg->floor_set || !cfg->ceiling_set)
-		return (print_error("Missing floor or ceiling color"));
 	i = 0;
-	while (i < TEX_COUNT)
+	while (i < game->config.light_count)
 	{
-		if (!cfg->has_texture[i])
-			return (print_error("Missing texture definition"));
+		light = &game->config.light[i];
+		if (light->x < 0.0 || light->y < 0.0
+			|| light_cell(game, b, (int)light->x, (int)light->y) != '0')
+			return (print_error("Light must sit in an open cell"));
 		i++;
 	}
 	return (0);
 }
 
-int	validate_scene(t_game *game)
+int	validate_scene(t_game *game, const t_map_builder *b)
 {
 	if (validate_config(&game->config))
 		return (1);
-	if (setup_player(game))
-		return (1);
-	if (check_map_cells(&game->map))
-		return (1);
-	return (0);
+	if (game->map.height <= 0)
+		return (print_error("Missing map section"));
+	return (validate_lights(game, b));
 }
@@ -0,0 +1,10 @@
+#include "cub3d.h"
+#include <time.h>
+
+long	now_usec(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000L + ts.tv_nsec / 1000);
+}
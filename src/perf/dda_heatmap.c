@@ -0,0 +1,108 @@
+#include "cub3d.h"
+#include <stdio.h>
+
+static const unsigned int	g_heat_stops[5] = {
+	0x000020, 0x2020C8, 0xD02020, 0xFFA000, 0xFFFFE0};
+
+static unsigned int	heat_color(unsigned int count, double log_max)
+{
+	double			t;
+	int				i;
+	unsigned int	a;
+	unsigned int	b;
+	int				ch[3];
+
+	if (count == 0 || log_max <= 0)
+		return (0x000000);
+	t = log(1.0 + count) / log_max * 4.0;
+	i = (int)t;
+	if (i >= 4)
+		return (g_heat_stops[4]);
+	t -= i;
+	a = g_heat_stops[i];
+	b = g_heat_stops[i + 1];
+	ch[0] = (int)(((a >> 16) & 0xFF) * (1 - t) + ((b >> 16) & 0xFF) * t);
+	ch[1] = (int)(((a >> 8) & 0xFF) * (1 - t) + ((b >> 8) & 0xFF) * t);
+	ch[2] = (int)((a & 0xFF) * (1 - t) + (b & 0xFF) * t);
+	return ((ch[0] << 16) | (ch[1] << 8) | ch[2]);
+}
+
+static void	fill_row(const t_dda_stats *stats, const t_map *map,
+			unsigned int *row, long hy)
+{
+	unsigned int	count;
+	int				hx;
+
+	hx = 0;
+	while (hx < stats->heat_w)
+	{
+		count = stats->heat[hy * stats->heat_w + hx];
+		row[hx] = count;
+		if (count == 0 && map_cell(map, hx << stats->heat_shift,
+				(int)hy << stats->heat_shift) > '0')
+			row[hx] = 0xFFFFFFFFu;
+		hx++;
+	}
+}
+
+static void	pack_row(unsigned int *counts, unsigned char *out, int width,
+			double log_max)
+{
+	unsigned int	color;
+	int				x;
+
+	x = 0;
+	while (x < width)
+	{
+		color = 0x303030;
+		if (counts[x] != 0xFFFFFFFFu)
+			color = heat_color(counts[x], log_max);
+		out[x * 3] = (color >> 16) & 0xFF;
+		out[x * 3 + 1] = (color >> 8) & 0xFF;
+		out[x * 3 + 2] = color & 0xFF;
+		x++;
+	}
+}
+
+static int	write_rows(const t_dda_stats *stats, const t_map *map, int fd)
+{
+	unsigned int	*counts;
+	unsigned char	*out;
+	double			log_max;
+	long			hy;
+	int				status;
+
+	counts = safe_malloc(sizeof(unsigned int) * stats->heat_w);
+	out = safe_malloc((size_t)stats->heat_w * 3);
+	log_max = log(1.0 + dda_heat_max(stats));
+	status = 0;
+	hy = 0;
+	while (!status && hy < stats->heat_h)
+	{
+		fill_row(stats, map, counts, hy);
+		pack_row(counts, out, stats->heat_w, log_max);
+		status = write_all(fd, out, (size_t)stats->heat_w * 3);
+		hy++;
+	}
+	free(counts);
+	free(out);
+	return (status);
+}
+
+int	dda_heatmap_write(const t_dda_stats *stats, const t_map *map,
+		const char *path)
+{
+	char	head[64];
+	int		fd;
+	int		status;
+
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return (print_error("Unable to open heatmap file"));
+	status = write_all(fd, head, snprintf(head, sizeof(head),
+				"P6\n%d %d\n255\n", stats->heat_w, stats->heat_h))
+		|| write_rows(stats, map, fd);
+	if (close(fd) || status)
+		return (print_error("Failed to write heatmap"));
+	return (0);
+}
@@ -0,0 +1,63 @@
+#include "cub3d.h"
+#include <stdio.h>
+
+unsigned int	dda_heat_max(const t_dda_stats *stats)
+{
+	unsigned int	max;
+	long			i;
+
+	max = 0;
+	i = 0;
+	while (i < (long)stats->heat_w * stats->heat_h)
+	{
+		if (stats->heat[i] > max)
+			max = stats->heat[i];
+		i++;
+	}
+	return (max);
+}
+
+void	dda_stats_print_json(const t_dda_stats *stats, int last)
+{
+	const char	*sep;
+	double		mean;
+
+	sep = ",";
+	if (last)
+		sep = "";
+	mean = 0.0;
+	if (stats->total_rays)
+		mean = (double)stats->total_steps / stats->total_rays;
+	printf("  \"dda\": {\"frames\": %ld, \"rays\": %ld, \"steps\": %ld, "
+		"\"mean_steps\": %.2f, \"worst_frame_mean\": %.2f, "
+		"\"max_steps\": %ld, \"escapes\": %ld, \"fogged\": %ld, "
+		"\"heat_cell\": %d, \"hottest_cell_visits\": %u}%s\n",
+		stats->frames, stats->total_rays, stats->total_steps, mean,
+		stats->worst_frame_mean, stats->worst_frame_max, stats->total_escapes,
+		stats->total_fogged, 1 << stats->heat_shift, dda_heat_max(stats), sep);
+}
+
+int	init_dda_stats(t_game *game)
+{
+	if (!game->opts.heatmap_path)
+		return (0);
+	game->dda = safe_malloc(sizeof(t_dda_stats));
+	return (dda_stats_init(game->dda, &game->map));
+}
+
+void	finish_dda_stats(t_game *game)
+{
+	if (!game->dda)
+		return ;
+	if (!dda_heatmap_write(game->dda, &game->map, game->opts.heatmap_path)
+		&& !game->opts.headless)
+	{
+		printf("{\n");
+		dda_stats_print_json(game->dda, 1);
+		printf("}\n");
+		fflush(stdout);
+	}
+	dda_stats_free(game->dda);
+	free(game->dda);
+	game->dda = NULL;
+}
@@ -0,0 +1,79 @@
+#include "cub3d.h"
+
+int	dda_stats_init(t_dda_stats *stats, const t_map *map)
+{
+	ft_bzero(stats, sizeof(t_dda_stats));
+	while ((long)(((map->width - 1) >> stats->heat_shift) + 1)
+		* (((map->height - 1) >> stats->heat_shift) + 1) > HEAT_MAX_CELLS)
+		stats->heat_shift++;
+	stats->heat_w = ((map->width - 1) >> stats->heat_shift) + 1;
+	stats->heat_h = ((map->height - 1) >> stats->heat_shift) + 1;
+	stats->heat = ft_calloc((size_t)stats->heat_w * stats->heat_h,
+			sizeof(unsigned int));
+	return (0);
+}
+
+void	dda_stats_free(t_dda_stats *stats)
+{
+	free(stats->heat);
+	ft_bzero(stats, sizeof(t_dda_stats));
+}
+
+static void	record_ray(t_dda_stats *stats, long steps, int status)
+{
+	long	max;
+
+	__atomic_fetch_add(&stats->rays, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&stats->steps, steps, __ATOMIC_RELAXED);
+	if (status < 0)
+		__atomic_fetch_add(&stats->escapes, 1, __ATOMIC_RELAXED);
+	else if (status == 0)
+		__atomic_fetch_add(&stats->fogged, 1, __ATOMIC_RELAXED);
+	max = __atomic_load_n(&stats->max_steps, __ATOMIC_RELAXED);
+	while (steps > max && !__atomic_compare_exchange_n(&stats->max_steps,
+			&max, steps, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+		;
+}
+
+int	dda_step_counted(const t_map *map, t_ray *ray, t_dda_stats *stats)
+{
+	int	status;
+	int	steps;
+
+	steps = 0;
+	status = 0;
+	while (status == 0 && (steps == 0 || ray->side_dist_x < ray->limit
+			|| ray->side_dist_y < ray->limit))
+	{
+		status = ray_advance_cell(map, ray);
+		steps++;
+		if (status >= 0)
+			__atomic_fetch_add(&stats->heat[(long)(ray->map_y
+					>> stats->heat_shift) * stats->heat_w
+				+ (ray->map_x >> stats->heat_shift)], 1, __ATOMIC_RELAXED);
+	}
+	record_ray(stats, steps, status);
+	if (status <= 0)
+		return (-1);
+	return (ray_finish_hit(ray, steps));
+}
+
+void	dda_stats_frame(t_dda_stats *stats)
+{
+	if (stats->rays == 0)
+		return ;
+	stats->frames++;
+	stats->total_rays += stats->rays;
+	stats->total_steps += stats->steps;
+	stats->total_escapes += stats->escapes;
+	stats->total_fogged += stats->fogged;
+	if (stats->max_steps > stats->worst_frame_max)
+		stats->worst_frame_max = stats->max_steps;
+	if ((double)stats->steps / stats->rays > stats->worst_frame_mean)
+		stats->worst_frame_mean = (double)stats->steps / stats->rays;
+	stats->rays = 0;
+	stats->steps = 0;
+	stats->escapes = 0;
+	stats->fogged = 0;
+	stats->max_steps = 0;
+}
@@ -0,0 +1,78 @@
+#include "cub3d.h"
+#include <stdio.h>
+
+static int	hist_index(long value)
+{
+	int	msb;
+	int	shift;
+
+	if (value < 0)
+		value = 0;
+	if (value < 64)
+		return ((int)value);
+	msb = 63 - __builtin_clzl((unsigned long)value);
+	shift = msb - 5;
+	if (64 + (msb - 6) * 32 + (int)((value >> shift) - 32) >= HIST_BUCKETS)
+		return (HIST_BUCKETS - 1);
+	return (64 + (msb - 6) * 32 + (int)((value >> shift) - 32));
+}
+
+static long	hist_value(int index)
+{
+	int	msb;
+
+	if (index < 64)
+		return (index);
+	msb = (index - 64) / 32 + 6;
+	return ((long)(32 + (index - 64) % 32) << (msb - 5));
+}
+
+void	hist_add(t_hist *hist, long value)
+{
+	hist->buckets[hist_index(value)]++;
+	hist->count++;
+	hist->sum += value;
+	if (value > hist->max)
+		hist->max = value;
+}
+
+long	hist_percentile(const t_hist *hist, double pct)
+{
+	long	rank;
+	long	seen;
+	int		i;
+
+	if (hist->count == 0)
+		return (0);
+	rank = (long)(hist->count * pct / 100.0);
+	if (rank >= hist->count)
+		rank = hist->count - 1;
+	seen = 0;
+	i = 0;
+	while (i < HIST_BUCKETS)
+	{
+		seen += hist->buckets[i];
+		if (seen > rank)
+			return (hist_value(i));
+		i++;
+	}
+	return (hist->max);
+}
+
+void	hist_print_json(const t_hist *hist, const char *name, int last)
+{
+	const char	*sep;
+	double		avg;
+
+	sep = ",";
+	if (last)
+		sep = "";
+	avg = 0.0;
+	if (hist->count)
+		avg = (double)hist->sum / hist->count;
+	printf("  \"%s\": {\"count\": %ld, \"avg_us\": %.1f, \"p50_us\": %ld, "
+		"\"p95_us\": %ld, \"p99_us\": %ld, \"max_us\": %ld}%s\n", name,
+		hist->count, avg, hist_percentile(hist, 50.0),
+		hist_percentile(hist, 95.0), hist_percentile(hist, 99.0),
+		hist->max, sep);
+}
@@ -0,0 +1,82 @@
+#include "cub3d.h"
+#include <stdio.h>
+
+void	hud_frame(t_game *game, long now)
+{
+	t_hud	*hud;
+	long	work;
+
+	hud = &game->hud;
+	if (hud->last_usec)
+	{
+		hud->frame_ms[hud->head] = (now - hud->last_usec) / 1000.0f;
+		hud->head = (hud->head + 1) % HUD_HISTORY;
+		if (hud->filled < HUD_HISTORY)
+			hud->filled++;
+		work = __atomic_load_n(&game->pool.work_us, __ATOMIC_RELAXED);
+		if (now > hud->wall_mark && game->pool.size > 0)
+			hud->util = (double)(work - hud->work_mark)
+				/ ((now - hud->wall_mark) * (double)game->pool.size);
+		hud->work_mark = work;
+		hud->wall_mark = now;
+	}
+	hud->last_usec = now;
+}
+
+static double	average_ms(t_hud *hud, int count)
+{
+	double	sum;
+	int		i;
+
+	if (count > hud->filled)
+		count = hud->filled;
+	if (count == 0)
+		return (0.0);
+	sum = 0.0;
+	i = 0;
+	while (i < count)
+	{
+		sum += hud->frame_ms[(hud->head - 1 - i + HUD_HISTORY) % HUD_HISTORY];
+		i++;
+	}
+	return (sum / count);
+}
+
+static void	hud_lines(t_game *game, t_hud *hud, int x, int y)
+{
+	char	line[64];
+	double	ms;
+	double	fps;
+	double	steps;
+
+	ms = average_ms(hud, 60);
+	fps = 0.0;
+	if (ms > 0)
+		fps = 1000.0 / ms;
+	steps = 0.0;
+	if (hud->rays)
+		steps = (double)hud->dda_steps / hud->rays;
+	snprintf(line, sizeof(line), "FPS %.1f  %.2f MS", fps, ms);
+	hud_text(&game->frame, x, y, line);
+	snprintf(line, sizeof(line), "UPD %.2f  RAY %.2f",
+		hud->stage_us[HUD_STAGE_UPDATE] / 1000.0,
+		hud->stage_us[HUD_STAGE_RAYS] / 1000.0);
+	hud_text(&game->frame, x, y + 6 * HUD_SCALE + 4, line);
+	snprintf(line, sizeof(line), "HUD %.2f  PUT %.2f",
+		hud->stage_us[HUD_STAGE_HUD] / 1000.0,
+		hud->stage_us[HUD_STAGE_PRESENT] / 1000.0);
+	hud_text(&game->frame, x, y + 2 * (6 * HUD_SCALE + 4), line);
+	snprintf(line, sizeof(line), "DDA %.1f/RAY  THR %.0f%% X%d", steps,
+		hud->util * 100.0, game->pool.size);
+	hud_text(&game->frame, x, y + 3 * (6 * HUD_SCALE + 4), line);
+}
+
+void	hud_draw(t_game *game)
+{
+	int	top;
+
+	top = 8 + 4 * (6 * HUD_SCALE + 4) + 4;
+	hud_shade(&game->frame, 8, 8, HUD_PANEL_W, top + 60 + 8);
+	hud_lines(game, &game->hud, 16, 16);
+	hud_graph(&game->hud, &game->frame, 16, top);
+}
@@ -0,0 +1,73 @@
+#include "cub3d.h"
+
+static const char	*g_hud_chars = "0123456789.:%/-ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+static const unsigned short	g_hud_glyphs[] = {
+	0x7B6F, 0x2C97, 0x73E7, 0x73CF, 0x5BC9, 0x79CF, 0x79EF, 0x7292,
+	0x7BEF, 0x7BCF, 0x0002, 0x0410, 0x52A5, 0x12A4, 0x01C0, 0x2BED,
+	0x6BAE, 0x3923, 0x6B6E, 0x79A7, 0x79A4, 0x396B, 0x5BED, 0x7497,
+	0x126A, 0x5BAD, 0x4927, 0x5FED, 0x6B6D, 0x2B6A, 0x6BA4, 0x2B73,
+	0x6BAD, 0x388E, 0x7492, 0x5B6F, 0x5B6A, 0x5BFD, 0x5AAD, 0x5A92,
+	0x72A7};
+
+static int	glyph_index(char c)
+{
+	int	i;
+
+	if (c >= 'a' && c <= 'z')
+		c -= 'a' - 'A';
+	i = 0;
+	while (g_hud_chars[i])
+	{
+		if (g_hud_chars[i] == c)
+			return (i);
+		i++;
+	}
+	return (-1);
+}
+
+static void	draw_block(t_img *img, int x, int y, int color)
+{
+	int	dx;
+	int	dy;
+
+	dy = 0;
+	while (dy < HUD_SCALE)
+	{
+		dx = 0;
+		while (dx < HUD_SCALE)
+		{
+			draw_pixel(img, x + dx, y + dy, color);
+			dx++;
+		}
+		dy++;
+	}
+}
+
+static void	draw_glyph(t_img *img, int x, int y, unsigned short bits)
+{
+	int	bit;
+
+	bit = 0;
+	while (bit < 15)
+	{
+		if (bits & (1 << (14 - bit)))
+			draw_block(img, x + (bit % 3) * HUD_SCALE,
+				y + (bit / 3) * HUD_SCALE, 0xFFFFFF);
+		bit++;
+	}
+}
+
+void	hud_text(t_img *img, int x, int y, const char *text)
+{
+	int	index;
+
+	while (*text)
+	{
+		index = glyph_index(*text);
+		if (index >= 0)
+			draw_glyph(img, x, y, g_hud_glyphs[index]);
+		x += 4 * HUD_SCALE;
+		text++;
+	}
+}
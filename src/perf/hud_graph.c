@@ -0,0 +1,75 @@
+#include "cub3d.h"
+
+#define HUD_GRAPH_H 60
+#define HUD_GRAPH_MS 33.3f
+
+void	hud_shade(t_img *img, int x0, int y0, int x1, int y1)
+{
+	unsigned int	*row;
+	int				x;
+
+	if (x1 > img->width)
+		x1 = img->width;
+	if (y1 > img->height)
+		y1 = img->height;
+	while (y0 < y1)
+	{
+		row = (unsigned int *)(img->addr + (long)y0 * img->line_len);
+		x = x0;
+		while (x < x1)
+		{
+			row[x] = (row[x] >> 2) & 0x3F3F3F;
+			x++;
+		}
+		y0++;
+	}
+}
+
+static int	bar_color(float ms)
+{
+	if (ms <= 1000.0f / 60.0f)
+		return (0x40D040);
+	if (ms <= HUD_GRAPH_MS)
+		return (0xE0C030);
+	return (0xE04040);
+}
+
+static void	draw_bar(t_img *img, int x, int bottom, float ms)
+{
+	int	height;
+	int	color;
+
+	height = (int)(ms * HUD_GRAPH_H / HUD_GRAPH_MS);
+	if (height > HUD_GRAPH_H)
+		height = HUD_GRAPH_H;
+	if (height < 1)
+		height = 1;
+	color = bar_color(ms);
+	while (height-- > 0)
+		draw_pixel(img, x, bottom - height, color);
+}
+
+void	hud_graph(t_hud *hud, t_img *img, int x, int y)
+{
+	int	i;
+	int	slot;
+	int	target;
+
+	target = y + HUD_GRAPH_H - (int)(HUD_GRAPH_H * (1000.0f / 60.0f)
+			/ HUD_GRAPH_MS);
+	i = 0;
+	while (i < HUD_HISTORY)
+	{
+		draw_pixel(img, x + i, target, 0x808080);
+		draw_pixel(img, x + i, y + HUD_GRAPH_H, 0x808080);
+		i++;
+	}
+	i = 0;
+	while (i < hud->filled)
+	{
+		slot = (hud->head - hud->filled + i + HUD_HISTORY) % HUD_HISTORY;
+		draw_bar(img, x + HUD_HISTORY - hud->filled + i, y + HUD_GRAPH_H - 1,
+			hud->frame_ms[slot]);
+		i++;
+	}
+}
@@ -0,0 +1,43 @@
+#include "cub3d.h"
+#include <stdio.h>
+
+void	latency_input(t_latency *lat, long usec)
+{
+	if (lat->pending_count < LAT_QUEUE)
+		lat->pending[lat->pending_count++] = usec;
+}
+
+void	latency_consume(t_latency *lat)
+{
+	int	i;
+
+	i = 0;
+	while (i < lat->pending_count && lat->applied_count < LAT_QUEUE)
+		lat->applied[lat->applied_count++] = lat->pending[i++];
+	lat->pending_count = 0;
+}
+
+void	latency_present(t_latency *lat, long usec)
+{
+	int	i;
+
+	i = 0;
+	while (i < lat->applied_count)
+	{
+		hist_add(&lat->hist, usec - lat->applied[i]);
+		i++;
+	}
+	lat->applied_count = 0;
+}
+
+void	latency_print(const t_latency *lat)
+{
+	if (lat->hist.count == 0)
+		return ;
+	printf("input-to-present latency over %ld events: p50 %.2f ms, "
+		"p95 %.2f ms, p99 %.2f ms, max %.2f ms\n", lat->hist.count,
+		hist_percentile(&lat->hist, 50.0) / 1000.0,
+		hist_percentile(&lat->hist, 95.0) / 1000.0,
+		hist_percentile(&lat->hist, 99.0) / 1000.0, lat->hist.max / 1000.0);
+	fflush(stdout);
+}
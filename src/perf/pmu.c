@@ -0,0 +1,88 @@
+#include "cub3d.h"
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+
+static const unsigned long long	g_pmu_config[PMU_EVENTS][2] = {
+	{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+	{PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+	{PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D
+		| (PERF_COUNT_HW_CACHE_OP_READ << 8)
+		| (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+	{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+	{PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}};
+
+static int	open_counter(int index)
+{
+	struct perf_event_attr	attr;
+
+	ft_bzero(&attr, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = (unsigned int)g_pmu_config[index][0];
+	attr.config = g_pmu_config[index][1];
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	return ((int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+int	pmu_open(t_pmu *pmu)
+{
+	int	i;
+
+	i = 0;
+	while (i < PMU_EVENTS)
+	{
+		pmu->fd[i] = open_counter(i);
+		if (pmu->fd[i] >= 0)
+			pmu->open_count++;
+		i++;
+	}
+	return (pmu->open_count == 0);
+}
+
+void	pmu_close(t_pmu *pmu)
+{
+	int	i;
+
+	i = 0;
+	while (i < PMU_EVENTS)
+	{
+		if (pmu->fd[i] >= 0)
+			close(pmu->fd[i]);
+		pmu->fd[i] = -1;
+		i++;
+	}
+	pmu->open_count = 0;
+}
+
+void	pmu_mark(t_pmu *pmu)
+{
+	int	i;
+
+	i = 0;
+	while (i < PMU_EVENTS)
+	{
+		if (pmu->fd[i] < 0
+			|| read(pmu->fd[i], &pmu->mark[i], sizeof(long long))
+			!= sizeof(long long))
+			pmu->mark[i] = -1;
+		i++;
+	}
+}
+
+void	pmu_stage(t_pmu *pmu, int stage)
+{
+	long long	now;
+	int			i;
+
+	i = 0;
+	while (i < PMU_EVENTS)
+	{
+		if (pmu->fd[i] < 0
+			|| read(pmu->fd[i], &now, sizeof(long long)) != sizeof(long long))
+			now = -1;
+		if (now >= 0 && pmu->mark[i] >= 0)
+			pmu->frame[stage][i] += now - pmu->mark[i];
+		pmu->mark[i] = now;
+		i++;
+	}
+}
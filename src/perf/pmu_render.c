@@ -0,0 +1,40 @@
+#include "cub3d.h"
+
+static void	reserve_rays(t_pmu *pmu, int width)
+{
+	if (width <= pmu->ray_cap)
+		return ;
+	free(pmu->rays);
+	free(pmu->steps);
+	pmu->rays = safe_malloc(sizeof(t_ray) * width);
+	pmu->steps = safe_malloc(sizeof(int) * width);
+	pmu->ray_cap = width;
+}
+
+void	pmu_render(t_game *game, t_view *view)
+{
+	t_pmu	*pmu;
+	t_span	span;
+	int		x;
+
+	pmu = game->pmu;
+	reserve_rays(pmu, view->target->width);
+	pmu_mark(pmu);
+	render_background(game, view->target, 0, view->target->width);
+	pmu_stage(pmu, PMU_BACKGROUND);
+	span.rays = pmu->rays;
+	span.steps = pmu->steps;
+	span.x0 = 0;
+	span.x1 = view->target->width;
+	span_cast(game, view, &span);
+	pmu_stage(pmu, PMU_DDA);
+	x = -1;
+	while (++x < view->target->width)
+	{
+		if (pmu->steps[x] < 0 || pmu->rays[x].perp_dist <= 0)
+			continue ;
+		view->steps += pmu->steps[x];
+		render_wall(game, view, x, &pmu->rays[x]);
+	}
+	pmu_stage(pmu, PMU_TEXTURE);
+}
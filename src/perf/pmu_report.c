@@ -0,0 +1,98 @@
+#include "cub3d.h"
+#include <stdio.h>
+
+static const char	*g_pmu_stages[PMU_STAGES] = {
+	"background", "dda", "texture", "present"};
+
+void	pmu_end_frame(t_pmu *pmu)
+{
+	char	line[256];
+	int		stage;
+	int		i;
+	int		n;
+
+	stage = -1;
+	while (++stage < PMU_STAGES)
+	{
+		n = snprintf(line, sizeof(line), "%ld,%s,%lld,%lld,%lld,%lld,%lld\n",
+				pmu->frames, g_pmu_stages[stage], pmu->frame[stage][0],
+				pmu->frame[stage][1], pmu->frame[stage][2],
+				pmu->frame[stage][3], pmu->frame[stage][4]);
+		if (pmu->csv_fd >= 0)
+			write_all(pmu->csv_fd, line, n);
+		i = -1;
+		while (++i < PMU_EVENTS)
+		{
+			pmu->total[stage][i] += pmu->frame[stage][i];
+			pmu->frame[stage][i] = 0;
+		}
+	}
+	pmu->frames++;
+}
+
+void	pmu_print_json(const t_pmu *pmu, int last)
+{
+	const long long	*t;
+	const char		*sep;
+	double			frames;
+	int				stage;
+
+	sep = ",";
+	if (last)
+		sep = "";
+	frames = pmu->frames;
+	if (frames < 1)
+		frames = 1;
+	printf("  \"pmu\": {\"frames\": %ld, \"counters\": %d", pmu->frames,
+		pmu->open_count);
+	stage = -1;
+	while (++stage < PMU_STAGES)
+	{
+		t = pmu->total[stage];
+		printf(", \"%s\": {\"cycles\": %.0f, \"instructions\": %.0f, "
+			"\"ipc\": %.2f, \"l1d_misses\": %.0f, \"llc_misses\": %.0f, "
+			"\"branch_misses\": %.0f}", g_pmu_stages[stage], t[0] / frames,
+			t[1] / frames, t[1] / (t[0] + 1e-9), t[2] / frames, t[3] / frames,
+			t[4] / frames);
+	}
+	printf("}%s\n", sep);
+}
+
+int	init_pmu(t_game *game)
+{
+	const char	*head;
+
+	if (!game->opts.pmu_path)
+		return (0);
+	game->pmu = ft_calloc(1, sizeof(t_pmu));
+	if (pmu_open(game->pmu))
+		perror("cub3D: hardware counters unavailable, reporting zeros");
+	game->pmu->csv_fd = open(game->opts.pmu_path,
+			O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (game->pmu->csv_fd < 0)
+		return (print_error("Unable to open perf counter output"));
+	head = "frame,stage,cycles,instructions,l1d_misses,llc_misses,"
+		"branch_misses\n";
+	write_all(game->pmu->csv_fd, head, ft_strlen(head));
+	return (0);
+}
+
+void	finish_pmu(t_game *game)
+{
+	if (!game->pmu)
+		return ;
+	if (!game->opts.headless)
+	{
+		printf("{\n");
+		pmu_print_json(game->pmu, 1);
+		printf("}\n");
+		fflush(stdout);
+	}
+	pmu_close(game->pmu);
+	if (game->pmu->csv_fd >= 0)
+		close(game->pmu->csv_fd);
+	free(game->pmu->rays);
+	free(game->pmu->steps);
+	free(game->pmu);
+	game->pmu = NULL;
+}
@@ -0,0 +1,37 @@
+#include "cub3d.h"
+#include <stdio.h>
+
+static void	print_bench_setup(t_game *game)
+{
+	printf("  \"map\": \"%s\",\n", game->opts.map_path);
+	printf("  \"trace\": \"%s\",\n", game->opts.replay_path);
+	printf("  \"resolution\": [%d, %d],\n", game->frame.width,
+		game->frame.height);
+	printf("  \"threads\": %d,\n", game->pool.size);
+	if (game->config.light_count)
+		printf("  \"lightmap\": {\"faces\": %d, \"bake_ms\": %.3f, "
+			"\"cached\": %d},\n", game->light.count,
+			game->light.bake_us / 1000.0, game->light.cached);
+}
+
+void	print_bench_report(t_game *game, t_hist *frames, long total_us)
+{
+	double	fps;
+
+	fps = 0.0;
+	if (total_us > 0)
+		fps = frames->count * 1e6 / total_us;
+	printf("{\n");
+	print_bench_setup(game);
+	printf("  \"total_ms\": %.3f,\n", total_us / 1000.0);
+	printf("  \"fps\": %.2f,\n", fps);
+	hist_print_json(frames, "frame_time", 0);
+	hist_print_json(&game->latency.hist, "input_latency",
+		!game->dda && !game->pmu);
+	if (game->dda)
+		dda_stats_print_json(game->dda, !game->pmu);
+	if (game->pmu)
+		pmu_print_json(game->pmu, 1);
+	printf("}\n");
+	fflush(stdout);
+}
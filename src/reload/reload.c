@@ -0,0 +1,104 @@
+#include "cub3d.h"
+#include <sys/inotify.h>
+
+static void	*reload_main(void *arg)
+{
+	t_reload	*rl;
+	int			mask;
+
+	rl = (t_reload *)arg;
+	while (!__atomic_load_n(&rl->stop, __ATOMIC_ACQUIRE))
+	{
+		mask = reload_events(rl);
+		if (!mask)
+			continue ;
+		pthread_mutex_lock(&rl->lock);
+		mask = reload_stage(rl);
+		__atomic_store_n(&rl->ready, mask, __ATOMIC_RELEASE);
+		while (rl->ready && !rl->stop)
+			pthread_cond_wait(&rl->idle, &rl->lock);
+		pthread_mutex_unlock(&rl->lock);
+	}
+	return (NULL);
+}
+
+int	init_reload(t_game *game)
+{
+	t_reload	*rl;
+
+	if (!game->opts.watch)
+		return (0);
+	rl = ft_calloc(1, sizeof(t_reload));
+	rl->game = game;
+	rl->next = ft_calloc(1, sizeof(t_game));
+	pthread_mutex_init(&rl->lock, NULL);
+	pthread_cond_init(&rl->idle, NULL);
+	game->reload = rl;
+	rl->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (rl->fd < 0)
+		return (print_error("File watching unavailable"));
+	if (reload_watch(rl, game))
+		return (1);
+	if (pthread_create(&rl->thread, NULL, reload_main, rl))
+		return (print_error("Failed to start reload thread"));
+	rl->started = 1;
+	return (0);
+}
+
+void	reload_poll(t_game *game)
+{
+	t_reload	*rl;
+	int			staged;
+
+	rl = game->reload;
+	staged = __atomic_load_n(&rl->ready, __ATOMIC_ACQUIRE);
+	if (!staged)
+		return ;
+	pthread_mutex_lock(&rl->lock);
+	reload_apply(game, rl, staged);
+	__atomic_store_n(&rl->ready, 0, __ATOMIC_RELEASE);
+	pthread_cond_signal(&rl->idle);
+	pthread_mutex_unlock(&rl->lock);
+}
+
+void	finish_reload(t_game *game)
+{
+	t_reload	*rl;
+
+	rl = game->reload;
+	if (!rl)
+		return ;
+	if (rl->started)
+	{
+		pthread_mutex_lock(&rl->lock);
+		__atomic_store_n(&rl->stop, 1, __ATOMIC_RELEASE);
+		pthread_cond_broadcast(&rl->idle);
+		pthread_mutex_unlock(&rl->lock);
+		pthread_join(rl->thread, NULL);
+	}
+	if (rl->fd >= 0)
+		close(rl->fd);
+	reload_discard(rl);
+	pthread_cond_destroy(&rl->idle);
+	pthread_mutex_destroy(&rl->lock);
+	free(rl->patch.cells);
+	free(rl->next);
+	free(rl);
+	game->reload = NULL;
+}
+
+void	reload_discard(t_reload *rl)
+{
+	int	i;
+
+	free_config(&rl->next->config);
+	free_map(&rl->next->map);
+	free_lightmap(&rl->next->light);
+	i = 0;
+	while (i < TEX_SLOTS)
+	{
+		free(rl->tex[i].addr);
+		ft_bzero(&rl->tex[i], sizeof(t_img));
+		i++;
+	}
+}
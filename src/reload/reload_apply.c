@@ -0,0 +1,104 @@
+#include "cub3d.h"
+#include <stdio.h>
+
+static void	resize_heat(t_dda_stats *dda, const t_map *map)
+{
+	t_dda_stats	keep;
+
+	free(dda->heat);
+	keep = *dda;
+	dda_stats_init(dda, map);
+	keep.heat = dda->heat;
+	keep.heat_w = dda->heat_w;
+	keep.heat_h = dda->heat_h;
+	keep.heat_shift = dda->heat_shift;
+	*dda = keep;
+}
+
+static void	apply_map(t_game *game, t_reload *rl)
+{
+	t_cell_edit	*edit;
+	long		i;
+
+	if (rl->patch.reshaped)
+	{
+		free_map(&game->map);
+		game->map = rl->next->map;
+		ft_bzero(&rl->next->map, sizeof(t_map));
+		if (game->dda)
+			resize_heat(game->dda, &game->map);
+	}
+	i = 0;
+	while (!rl->patch.reshaped && i < rl->patch.count)
+	{
+		edit = &rl->patch.cells[i++];
+		map_set_cell(&game->map, edit->x, edit->y, edit->c);
+	}
+}
+
+static void	apply_scene(t_game *game, t_reload *rl)
+{
+	apply_map(game, rl);
+	free_config(&game->config);
+	game->config = rl->next->config;
+	ft_bzero(&rl->next->config, sizeof(t_config));
+	free_lightmap(&game->light);
+	game->light = rl->next->light;
+	ft_bzero(&rl->next->light, sizeof(t_lightmap));
+	game->fog = rl->next->fog;
+	minimap_invalidate(game);
+	if (map_is_solid(&game->map, (int)game->player.x, (int)game->player.y))
+	{
+		game->player = rl->next->player;
+		if (game->opts.fov > 0.0)
+			camera_set_plane(&game->player, view_plane_len(&game->opts));
+	}
+}
+
+static void	apply_textures(t_game *game, t_reload *rl)
+{
+	t_img	*tex;
+	t_img	*from;
+	int		i;
+
+	tex = safe_malloc(sizeof(t_img) * rl->table.count);
+	i = 0;
+	while (i < rl->table.count)
+	{
+		from = &rl->tex[i];
+		if (rl->reuse[i] >= 0)
+			from = &game->tex[rl->reuse[i]];
+		tex[i] = *from;
+		ft_bzero(from, sizeof(t_img));
+		i++;
+	}
+	destroy_textures(game);
+	game->tex = tex;
+	game->textures = rl->table;
+	texture_faces_bind(game);
+}
+
+void	reload_apply(t_game *game, t_reload *rl, int staged)
+{
+	long	start;
+
+	start = now_usec();
+	if (staged & RELOAD_MAP)
+		apply_scene(game, rl);
+	apply_textures(game, rl);
+	reproj_invalidate(game);
+	reload_watch(rl, game);
+	start = now_usec() - start;
+	if (!(staged & RELOAD_MAP))
+		printf("reload: %d texture(s)", rl->decoded);
+	else if (rl->patch.reshaped)
+		printf("reload: map rebuilt at %dx%d, %d texture(s)",
+			game->map.width, game->map.height, rl->decoded);
+	else
+		printf("reload: %ld cell(s) patched, %ld of %d row(s) revalidated, "
+			"%d texture(s)", rl->patch.count, rl->patch.rows_checked,
+			game->map.height, rl->decoded);
+	printf(", staged in %.2f ms, swapped in %.3f ms\n",
+		rl->stage_us / 1000.0, start / 1000.0);
+	fflush(stdout);
+}
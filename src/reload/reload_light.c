@@ -0,0 +1,80 @@
+#include "cub3d.h"
+
+static void	overlay_map(t_map *dst, const t_map *live, const t_map_patch *patch)
+{
+	const t_cell_edit	*edit;
+	char				**chunk;
+	long				n;
+	long				i;
+
+	*dst = *live;
+	map_doors_clone(&dst->doors, &live->doors);
+	n = (long)live->chunk_cols * live->chunk_rows;
+	dst->chunks = safe_malloc(sizeof(char *) * n);
+	ft_memcpy(dst->chunks, live->chunks, sizeof(char *) * n);
+	i = 0;
+	while (i < patch->count)
+	{
+		edit = &patch->cells[i++];
+		chunk = &dst->chunks[(long)(edit->y >> CHUNK_SHIFT) * dst->chunk_cols
+			+ (edit->x >> CHUNK_SHIFT)];
+		if (*chunk == live->chunks[chunk - dst->chunks])
+		{
+			*chunk = safe_malloc(CHUNK_CELLS);
+			ft_memcpy(*chunk, live->chunks[chunk - dst->chunks], CHUNK_CELLS);
+		}
+		(*chunk)[((edit->y & CHUNK_MASK) << CHUNK_SHIFT)
+			| (edit->x & CHUNK_MASK)] = edit->c;
+		map_door_set(dst, edit->x, edit->y, edit->c == DOOR_CELL);
+	}
+}
+
+static void	overlay_free(t_map *dst, const t_map *live)
+{
+	long	i;
+
+	i = 0;
+	while (i < (long)dst->chunk_cols * dst->chunk_rows)
+	{
+		if (dst->chunks[i] != live->chunks[i])
+			free(dst->chunks[i]);
+		i++;
+	}
+	free(dst->chunks);
+	free(dst->doors.items);
+	free(dst->doors.moving);
+	ft_bzero(dst, sizeof(t_map));
+}
+
+static int	reuse_light(t_game *next, const t_lightmap *live)
+{
+	t_lightmap	*lm;
+
+	lm = &next->light;
+	if (next->config.light_count == 0 || !live->samples
+		|| lightmap_hash(next) != live->hash)
+		return (1);
+	*lm = *live;
+	lm->cap = live->count;
+	lm->keys = safe_malloc(sizeof(long) * live->count + 1);
+	lm->samples = safe_malloc((size_t)live->count * LIGHT_SAMPLES + 1);
+	ft_memcpy(lm->keys, live->keys, sizeof(long) * live->count);
+	ft_memcpy(lm->samples, live->samples,
+		(size_t)live->count * LIGHT_SAMPLES);
+	return (0);
+}
+
+void	reload_bake(t_reload *rl)
+{
+	t_game	*next;
+
+	next = rl->next;
+	next->opts = rl->game->opts;
+	if (!rl->patch.reshaped)
+		overlay_map(&next->map, &rl->game->map, &rl->patch);
+	if (reuse_light(next, &rl->game->light))
+		lightmap_build(next);
+	fog_build(next);
+	if (!rl->patch.reshaped)
+		overlay_free(&next->map, &rl->game->map);
+}
@@ -0,0 +1,105 @@
+#include "cub3d.h"
+
+static int	stage_scene(t_reload *rl)
+{
+	t_map_builder	builder;
+	t_game			*next;
+	int				status;
+
+	next = rl->next;
+	ft_bzero(next, sizeof(t_game));
+	rl->patch.count = 0;
+	rl->patch.rows_checked = 0;
+	rl->patch.reshaped = 0;
+	map_builder_init(&builder);
+	builder.prev = &rl->game->map;
+	builder.patch = &rl->patch;
+	status = parse_scene_into(next, rl->game->opts.map_path, &builder);
+	if (status && rl->patch.reshaped)
+	{
+		free_config(&next->config);
+		ft_bzero(next, sizeof(t_game));
+		status = parse_scene(next, rl->game->opts.map_path);
+	}
+	if (status == 0)
+		return (0);
+	free_config(&next->config);
+	free_map(&next->map);
+	return (print_error("Reload failed, keeping the current scene"));
+}
+
+static int	live_slot(const t_tex_table *live, const char *path)
+{
+	int	i;
+
+	i = 0;
+	while (i < live->count
+		&& ft_strncmp(live->path[i], path, ft_strlen(path) + 1))
+		i++;
+	if (i == live->count)
+		return (-1);
+	return (i);
+}
+
+static int	stage_texture(t_reload *rl, int idx)
+{
+	ft_bzero(&rl->tex[idx], sizeof(t_img));
+	if (load_texture_file(&rl->tex[idx], rl->table.path[idx]) == 0)
+	{
+		rl->reuse[idx] = -1;
+		rl->decoded++;
+		return (0);
+	}
+	free(rl->tex[idx].addr);
+	ft_bzero(&rl->tex[idx], sizeof(t_img));
+	if (rl->reuse[idx] < 0)
+		return (1);
+	print_error("Reload failed, keeping the current texture");
+	return (0);
+}
+
+static int	stage_textures(t_reload *rl, const t_config *cfg)
+{
+	int	i;
+
+	texture_table_build(&rl->table, cfg);
+	rl->decoded = 0;
+	i = 0;
+	while (i < rl->table.count)
+	{
+		rl->reuse[i] = live_slot(&rl->game->textures, rl->table.path[i]);
+		if ((rl->reuse[i] < 0 || rl->dirty[rl->reuse[i] + 1])
+			&& stage_texture(rl, i))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+int	reload_stage(t_reload *rl)
+{
+	const t_config	*cfg;
+	long			start;
+	int				staged;
+
+	start = now_usec();
+	staged = 0;
+	cfg = &rl->game->config;
+	if (rl->dirty[0] && stage_scene(rl) == 0)
+	{
+		staged = RELOAD_MAP;
+		cfg = &rl->next->config;
+		reload_bake(rl);
+	}
+	if (stage_textures(rl, cfg))
+	{
+		reload_discard(rl);
+		print_error("Reload failed, keeping the current scene");
+		staged = 0;
+	}
+	else if (staged || rl->decoded)
+		staged |= RELOAD_TEX;
+	ft_bzero(rl->dirty, sizeof(rl->dirty));
+	rl->stage_us = now_usec() - start;
+	return (staged);
+}
@@ -0,0 +1,107 @@
+#include "cub3d.h"
+#include <sys/inotify.h>
+#include <poll.h>
+
+static int	watch_target(t_reload *rl, int slot, const char *path)
+{
+	char	dir[4096];
+	int		len;
+
+	len = ft_strlen(path) - 1;
+	while (len >= 0 && path[len] != '/')
+		len--;
+	if (len >= (int) sizeof(dir))
+		return (print_error("Watched path too long"));
+	if (len < 0)
+		ft_memcpy(dir, ".", 2);
+	else if (len == 0)
+		ft_memcpy(dir, "/", 2);
+	else
+		ft_memcpy(dir, path, len);
+	if (len > 0)
+		dir[len] = '\0';
+	rl->name[slot] = path + len + 1;
+	rl->wd[slot] = inotify_add_watch(rl->fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO);
+	if (rl->wd[slot] < 0)
+		return (print_error("Failed to watch scene files"));
+	return (0);
+}
+
+int	reload_watch(t_reload *rl, t_game *game)
+{
+	int	i;
+
+	if (watch_target(rl, 0, game->opts.map_path))
+		return (1);
+	i = 0;
+	while (i < game->textures.count)
+	{
+		if (watch_target(rl, i + 1, game->textures.path[i]))
+			return (1);
+		i++;
+	}
+	rl->slots = i + 1;
+	return (0);
+}
+
+static int	match_event(t_reload *rl, struct inotify_event *ev)
+{
+	int	hit;
+	int	slot;
+
+	hit = 0;
+	slot = 0;
+	while (ev->len && slot < rl->slots)
+	{
+		if (ev->wd == rl->wd[slot]
+			&& !ft_strncmp(ev->name, rl->name[slot], ev->len))
+		{
+			rl->dirty[slot] = 1;
+			hit = 1;
+		}
+		slot++;
+	}
+	return (hit);
+}
+
+static int	drain_events(t_reload *rl)
+{
+	char					buf[4096] __attribute__((aligned(8)));
+	struct inotify_event	*ev;
+	ssize_t					len;
+	ssize_t					off;
+	int						hit;
+
+	hit = 0;
+	len = read(rl->fd, buf, sizeof(buf));
+	while (len > 0)
+	{
+		off = 0;
+		while (off < len)
+		{
+			ev = (struct inotify_event *)(buf + off);
+			hit |= match_event(rl, ev);
+			off += sizeof(struct inotify_event) + ev->len;
+		}
+		len = read(rl->fd, buf, sizeof(buf));
+	}
+	return (hit);
+}
+
+int	reload_events(t_reload *rl)
+{
+	struct pollfd	pfd;
+	int				hit;
+
+	pfd.fd = rl->fd;
+	pfd.events = POLLIN;
+	if (poll(&pfd, 1, RELOAD_POLL_MS) <= 0)
+		return (0);
+	hit = drain_events(rl);
+	if (hit)
+	{
+		usleep(RELOAD_SETTLE_US);
+		hit |= drain_events(rl);
+	}
+	return (hit);
+}
@@ -1,26 +1,42 @@
 #include "cub3d.h"
 
-void	render_background(t_game *game)
+static void	fill_rows(t_img *img, int y0, int y1, int color)
+{
+	ft_fill32(img->addr + (long)y0 * img->line_len, color,
+		(size_t)img->width * (y1 - y0));
+}
+
+int	background_color(t_game *game, const t_img *img, int y, int half)
+{
+	int	color;
+
+	color = rgb_to_int(game->config.ceiling);
+	if (y >= half)
+		color = rgb_to_int(game->config.floor);
+	if (game->fog.limit >= FOG_OFF)
+		return (color);
+	return (fog_apply(&game->fog, color, fog_weight(&game->fog,
+				img->height / (2.0 * abs(y - half)))));
+}
+
+void	render_background(t_game *game, t_img *img, int x0, int x1)
 {
-	int	x;
 	int	y;
-	int	ceiling;
-	int	floor;
+	int	half;
 
-	ceiling = rgb_to_int(game->config.ceiling);
-	floor = rgb_to_int(game->config.floor);
+	half = img->height / 2;
+	if (x0 == 0 && x1 == img->width && img->line_len == img->width * 4
+		&& game->fog.limit >= FOG_OFF)
+	{
+		fill_rows(img, 0, half, rgb_to_int(game->config.ceiling));
+		fill_rows(img, half, img->height, rgb_to_int(game->config.floor));
+		return ;
+	}
 	y = 0;
-	while (y < WIN_HEIGHT)
+	while (y < img->height)
 	{
-		x = 0;
-		while (x < WIN_WIDTH)
-		{
-			if (y < WIN_HEIGHT / 2)
-				draw_pixel(&game->frame, x, y, ceiling);
-			else
-				draw_pixel(&game->frame, x, y, floor);
-			x++;
-		}
+		ft_fill32(img->addr + (long)y * img->line_len + x0 * 4,
+			background_color(game, img, y, half), x1 - x0);
 		y++;
 	}
 }
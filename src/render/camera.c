@@ -0,0 +1,50 @@
+#include "cub3d.h"
+
+double	view_plane_len(const t_options *opts)
+{
+	if (opts->fov <= 0.0)
+		return (PLANE_DEFAULT);
+	return (tan(opts->fov * M_PI / 360.0));
+}
+
+static void	build_table(t_camera *camera, int width)
+{
+	int	x;
+
+	free(camera->table);
+	camera->table = safe_malloc(sizeof(double) * width);
+	camera->cols = width;
+	x = 0;
+	while (x < width)
+	{
+		camera->table[x] = 2.0 * x / (double)width - 1.0;
+		x++;
+	}
+}
+
+void	view_setup(t_game *game)
+{
+	if (game->opts.width <= 0 || game->opts.height <= 0)
+	{
+		game->opts.width = WIN_WIDTH;
+		game->opts.height = WIN_HEIGHT;
+	}
+	if (game->camera.cols != game->opts.width)
+		build_table(&game->camera, game->opts.width);
+	if (game->opts.fov > 0.0)
+		camera_set_plane(&game->player, view_plane_len(&game->opts));
+}
+
+double	view_camera_x(const t_game *game, int width, int x)
+{
+	if (width == game->camera.cols)
+		return (game->camera.table[x]);
+	return (2.0 * x / (double)width - 1.0);
+}
+
+void	free_camera(t_camera *camera)
+{
+	free(camera->table);
+	camera->table = NULL;
+	camera->cols = 0;
+}
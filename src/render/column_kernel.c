@@ -0,0 +1,71 @@
+#include "cub3d.h"
+
+static inline __attribute__((always_inline)) unsigned int	shade_pixel(
+	const t_ray *ray, const t_column *col, unsigned int color)
+{
+	if (col->light >= 0)
+		color = ((((color & 0xFF00FF) * col->light) >> 7) & 0xFF00FF)
+			| ((((color & 0xFF00) * col->light) >> 7) & 0xFF00);
+	else if (ray->side == 1)
+		color = (color >> 1) & 0x7F7F7F;
+	if (col->fog)
+		color = ((((color & 0xFF00FF) * (256 - col->fog) + col->fog_rb) >> 8)
+				& 0xFF00FF) | ((((color & 0xFF00) * (256 - col->fog)
+						+ col->fog_g) >> 8) & 0xFF00);
+	return (color);
+}
+
+static inline __attribute__((always_inline)) void	column_kernel(
+	const t_img *dst, const t_ray *ray, const t_img *tex, const t_column *col)
+{
+	const char	*src;
+	char		*out;
+	double		step;
+	double		tex_pos;
+	int			y;
+
+	step = (double)tex->height / col->line_height;
+	tex_pos = (col->start - dst->height / 2 + col->line_height / 2) * step;
+	src = tex->addr + col->tex_x * (tex->bpp / 8);
+	out = dst->addr + (long)col->start * dst->line_len + col->x * 4;
+	y = col->start;
+	while (y++ <= col->end)
+	{
+		if ((int)tex_pos >= 0 && (int)tex_pos < tex->height)
+			*(unsigned int *)out = shade_pixel(ray, col, *(const unsigned int *)
+					(src + (int)tex_pos * tex->line_len));
+		else
+			*(unsigned int *)out = shade_pixel(ray, col, 0);
+		out += dst->line_len;
+		tex_pos += step;
+	}
+}
+
+static int	column_fixed(const t_img *dst, const t_ray *ray,
+				const t_img *tex, const t_column *col)
+{
+	if (dst->line_len != dst->width * 4)
+		return (1);
+	if (dst->width == 1280 && dst->height == 720)
+		column_kernel(&(const t_img){.addr = dst->addr, .width = 1280,
+			.height = 720, .line_len = 1280 * 4}, ray, tex, col);
+	else if (dst->width == 1920 && dst->height == 1080)
+		column_kernel(&(const t_img){.addr = dst->addr, .width = 1920,
+			.height = 1080, .line_len = 1920 * 4}, ray, tex, col);
+	else if (dst->width == 2560 && dst->height == 1440)
+		column_kernel(&(const t_img){.addr = dst->addr, .width = 2560,
+			.height = 1440, .line_len = 2560 * 4}, ray, tex, col);
+	else if (dst->width == 3840 && dst->height == 2160)
+		column_kernel(&(const t_img){.addr = dst->addr, .width = 3840,
+			.height = 2160, .line_len = 3840 * 4}, ray, tex, col);
+	else
+		return (1);
+	return (0);
+}
+
+void	draw_texture_column(t_view *view, t_ray *ray, t_img *tex,
+			t_column *col)
+{
+	if (column_fixed(view->target, ray, tex, col))
+		column_kernel(view->target, ray, tex, col);
+}
@@ -0,0 +1,52 @@
+#include "cub3d.h"
+
+void	fog_build(t_game *game)
+{
+	t_fog	*fog;
+	double	t;
+	int		i;
+
+	fog = &game->fog;
+	fog->limit = FOG_OFF;
+	if (!game->config.fog_set)
+		return ;
+	fog->limit = game->config.fog_dist;
+	fog->scale = FOG_LUT / fog->limit;
+	fog->color = rgb_to_int(game->config.fog);
+	i = 0;
+	while (i < FOG_LUT)
+	{
+		t = (i + 0.5) / FOG_LUT;
+		fog->weight[i++] = (unsigned short)(256.0 * t * t + 0.5);
+	}
+}
+
+int	fog_weight(const t_fog *fog, double dist)
+{
+	int	i;
+
+	if (dist >= fog->limit)
+		return (256);
+	i = (int)(dist * fog->scale);
+	if (i > FOG_LUT - 1)
+		i = FOG_LUT - 1;
+	return (fog->weight[i]);
+}
+
+unsigned int	fog_apply(const t_fog *fog, unsigned int color, int weight)
+{
+	return (((((color & 0xFF00FF) * (256 - weight)
+					+ (fog->color & 0xFF00FF) * weight) >> 8) & 0xFF00FF)
+		| ((((color & 0xFF00) * (256 - weight)
+					+ (fog->color & 0xFF00) * weight) >> 8) & 0xFF00));
+}
+
+void	fog_column(const t_fog *fog, t_column *col, double dist)
+{
+	col->fog = 0;
+	if (fog->limit >= FOG_OFF)
+		return ;
+	col->fog = fog_weight(fog, dist);
+	col->fog_rb = (fog->color & 0xFF00FF) * col->fog;
+	col->fog_g = (fog->color & 0xFF00) * col->fog;
+}
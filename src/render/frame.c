@@ -0,0 +1,53 @@
+#include "cub3d.h"
+
+static void	present_frame(t_game *game)
+{
+	if (game->pmu)
+		pmu_mark(game->pmu);
+	if (game->win)
+		mlx_put_image_to_window(game->mlx, game->win, game->frame.ptr, 0, 0);
+	if (game->pmu)
+	{
+		pmu_stage(game->pmu, PMU_PRESENT);
+		pmu_end_frame(game->pmu);
+	}
+}
+
+static void	cast_frame(t_game *game, t_view *view)
+{
+	view->cam = game->player;
+	view->target = &game->frame;
+	view->steps = 0;
+	view->stats = game->dda;
+	if (game->pmu)
+		pmu_render(game, view);
+	else if (game->opts.reproject && !game->dda)
+		reproj_render(game, view);
+	else
+		render_views(game, view, 1);
+}
+
+void	render_frame(t_game *game)
+{
+	t_view	view;
+	long	stamp[4];
+
+	stamp[0] = now_usec();
+	cast_frame(game, &view);
+	stamp[1] = now_usec();
+	if (game->dda)
+		dda_stats_frame(game->dda);
+	game->hud.dda_steps = view.steps;
+	game->hud.rays = game->frame.width;
+	if (game->minimap.visible)
+		minimap_draw(game);
+	if (game->hud.visible)
+		hud_draw(game);
+	stamp[2] = now_usec();
+	present_frame(game);
+	stamp[3] = now_usec();
+	latency_present(&game->latency, stamp[3]);
+	game->hud.stage_us[HUD_STAGE_RAYS] = stamp[1] - stamp[0];
+	game->hud.stage_us[HUD_STAGE_HUD] = stamp[2] - stamp[1];
+	game->hud.stage_us[HUD_STAGE_PRESENT] = stamp[3] - stamp[2];
+}
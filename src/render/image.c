@@ -21,18 +21,17 @@ void	draw_pixel(t_img *img, int x, int y, int color)
 
 void	clear_frame(t_img *img, int color)
 {
-	int	x;
 	int	y;
 
+	if (img->line_len == img->width * 4)
+	{
+		ft_fill32(img->addr, color, (size_t)img->width * img->height);
+		return ;
+	}
 	y = 0;
 	while (y < img->height)
 	{
-		x = 0;
-		while (x < img->width)
-		{
-			draw_pixel(img, x, y, color);
-			x++;
-		}
+		ft_fill32(img->addr + (long)y * img->line_len, color, img->width);
 		y++;
 	}
 }
@@ -0,0 +1,100 @@
+#include "cub3d.h"
+
+static int	light_box_hits(const t_config *cfg, int x0, int y0, int size)
+{
+	const t_light	*light;
+	double			dx;
+	double			dy;
+	int				i;
+
+	i = 0;
+	while (i < cfg->light_count)
+	{
+		light = &cfg->light[i++];
+		dx = fmax(fmax(x0 - light->x, light->x - (x0 + size)), 0.0);
+		dy = fmax(fmax(y0 - light->y, light->y - (y0 + size)), 0.0);
+		if (dx * dx + dy * dy < light->radius * light->radius)
+			return (1);
+	}
+	return (0);
+}
+
+static void	push_face(t_lightmap *lm, long key)
+{
+	long	*keys;
+
+	if (lm->count == lm->cap)
+	{
+		lm->cap = lm->cap * 2 + 64;
+		keys = safe_malloc(sizeof(long) * lm->cap);
+		ft_memcpy(keys, lm->keys, sizeof(long) * lm->count);
+		free(lm->keys);
+		lm->keys = keys;
+	}
+	lm->keys[lm->count++] = key;
+}
+
+int	lightmap_faces(const t_game *game, int x, int y, long *keys)
+{
+	static const int	nx[TEX_COUNT] = {0, 0, -1, 1};
+	static const int	ny[TEX_COUNT] = {1, -1, 0, 0};
+	char				c;
+	int					face;
+	int					n;
+
+	c = map_cell(&game->map, x, y);
+	if (c <= '0' || c == DOOR_CELL
+		|| !light_box_hits(&game->config, x, y, 1))
+		return (0);
+	n = 0;
+	face = 0;
+	while (face < TEX_COUNT)
+	{
+		c = map_cell(&game->map, x + nx[face], y + ny[face]);
+		if (c == '0' || c == DOOR_CELL)
+			keys[n++] = (map_cell_key(&game->map, x, y) << 2) | face;
+		face++;
+	}
+	return (n);
+}
+
+static void	collect_cell(t_game *game, int x, int y)
+{
+	long	keys[TEX_COUNT];
+	int		n;
+	int		i;
+
+	n = lightmap_faces(game, x, y, keys);
+	i = 0;
+	while (i < n)
+		push_face(&game->light, keys[i++]);
+}
+
+void	lightmap_collect(t_game *game)
+{
+	const t_map	*map;
+	long		chunk;
+	int			cell;
+	int			x0;
+	int			y0;
+
+	map = &game->map;
+	chunk = -1;
+	while (++chunk < (long)map->chunk_cols * map->chunk_rows)
+	{
+		x0 = (int)(chunk % map->chunk_cols) * CHUNK_SIZE;
+		y0 = (int)(chunk / map->chunk_cols) * CHUNK_SIZE;
+		if (map->chunks[chunk] == map->void_chunk
+			|| !light_box_hits(&game->config, x0, y0, CHUNK_SIZE))
+			continue ;
+		cell = 0;
+		while (cell < CHUNK_CELLS)
+		{
+			collect_cell(game, x0 + (cell & CHUNK_MASK),
+				y0 + (cell >> CHUNK_SHIFT));
+			cell++;
+		}
+	}
+	game->light.samples = safe_malloc((size_t)game->light.count
+			* LIGHT_SAMPLES + 1);
+}
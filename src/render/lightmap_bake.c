@@ -0,0 +1,90 @@
+#include "cub3d.h"
+
+static const int	g_normal[TEX_COUNT][2] = {{0, 1}, {0, -1}, {-1, 0},
+{1, 0}};
+
+static double	light_sample(const t_map *map, const t_light *light,
+			const double *p, const int *n)
+{
+	t_ray	ray;
+	double	dist;
+	double	lambert;
+	int		status;
+
+	dist = hypot(light->x - p[0], light->y - p[1]);
+	if (dist >= light->radius || dist == 0.0)
+		return (0.0);
+	ray.dir_x = (light->x - p[0]) / dist;
+	ray.dir_y = (light->y - p[1]) / dist;
+	lambert = ray.dir_x * n[0] + ray.dir_y * n[1];
+	if (lambert <= 0.0)
+		return (0.0);
+	ray_prepare(&ray, p[0], p[1]);
+	status = 0;
+	while (status == 0 && fmin(ray.side_dist_x, ray.side_dist_y) < dist)
+		status = ray_advance_cell(map, &ray);
+	if (status != 0)
+		return (0.0);
+	dist = 1.0 - dist / light->radius;
+	return (light->intensity * lambert * dist * dist);
+}
+
+static void	face_point(const t_map *map, long key, double u, double *p)
+{
+	const int	*n;
+	long		chunk;
+
+	n = g_normal[key & 3];
+	key >>= 2;
+	chunk = key >> (CHUNK_SHIFT * 2);
+	p[0] = (chunk % map->chunk_cols) * CHUNK_SIZE + (key & CHUNK_MASK)
+		+ 0.5 + n[0] * (0.5 + LIGHT_EPSILON);
+	p[1] = (chunk / map->chunk_cols) * CHUNK_SIZE
+		+ (key >> CHUNK_SHIFT & CHUNK_MASK) + 0.5
+		+ n[1] * (0.5 + LIGHT_EPSILON);
+	if (n[0] == 0)
+		p[0] += u - 0.5;
+	else
+		p[1] += u - 0.5;
+}
+
+static void	bake_face(const t_game *game, long key, unsigned char *out)
+{
+	double	p[2];
+	double	sum;
+	int		k;
+	int		i;
+
+	k = 0;
+	while (k < LIGHT_SAMPLES)
+	{
+		face_point(&game->map, key, (k + 0.5) / LIGHT_SAMPLES, p);
+		sum = LIGHT_AMBIENT;
+		i = 0;
+		while (i < game->config.light_count)
+			sum += light_sample(&game->map, &game->config.light[i++], p,
+					g_normal[key & 3]);
+		sum = fmin(sum, 1.0) * LIGHT_ONE / (1 + ((key & 3) < TEX_WE));
+		out[k++] = (unsigned char)(sum + 0.5);
+	}
+}
+
+void	lightmap_bake_range(void *ctx, int begin, int end)
+{
+	const t_game	*game;
+
+	game = (const t_game *)ctx;
+	while (begin < end)
+	{
+		bake_face(game, game->light.keys[begin],
+			game->light.samples + (long)begin * LIGHT_SAMPLES);
+		begin++;
+	}
+}
+
+void	free_lightmap(t_lightmap *lm)
+{
+	free(lm->keys);
+	free(lm->samples);
+	ft_bzero(lm, sizeof(t_lightmap));
+}
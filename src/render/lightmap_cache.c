@@ -0,0 +1,102 @@
+#include "cub3d.h"
+#include <stdio.h>
+
+static long	cache_count(const char *data, size_t len, unsigned long hash)
+{
+	long	count;
+
+	count = -1;
+	if (len >= LIGHT_HEADER && !ft_strncmp(data, LIGHT_MAGIC, 4)
+		&& *(t_u32u *)(data + 4) == LIGHT_VERSION
+		&& *(t_u64u *)(data + 8) == hash)
+		count = *(t_u64u *)(data + 16);
+	if (count < 0 || count > (long)len || len != LIGHT_HEADER
+		+ (size_t)count * (sizeof(long) + LIGHT_SAMPLES))
+		return (-1);
+	return (count);
+}
+
+int	lightmap_cache_load(t_lightmap *lm, const char *path)
+{
+	char	*data;
+	size_t	len;
+	long	count;
+
+	data = read_file(path, &len);
+	if (!data)
+		return (1);
+	count = cache_count(data, len, lm->hash);
+	if (count < 0)
+	{
+		free(data);
+		return (1);
+	}
+	lm->count = count;
+	lm->cap = count;
+	lm->keys = safe_malloc(sizeof(long) * count + 1);
+	lm->samples = safe_malloc((size_t)count * LIGHT_SAMPLES + 1);
+	ft_memcpy(lm->keys, data + LIGHT_HEADER, sizeof(long) * count);
+	ft_memcpy(lm->samples, data + LIGHT_HEADER + sizeof(long) * count,
+		(size_t)count * LIGHT_SAMPLES);
+	free(data);
+	return (0);
+}
+
+int	lightmap_cache_save(const t_lightmap *lm, const char *path)
+{
+	char	*data;
+	size_t	len;
+	int		status;
+
+	len = LIGHT_HEADER + (size_t)lm->count * (sizeof(long) + LIGHT_SAMPLES);
+	data = safe_malloc(len);
+	ft_memcpy(data, LIGHT_MAGIC, 4);
+	*(t_u32u *)(data + 4) = LIGHT_VERSION;
+	*(t_u64u *)(data + 8) = lm->hash;
+	*(t_u64u *)(data + 16) = lm->count;
+	ft_memcpy(data + LIGHT_HEADER, lm->keys, sizeof(long) * lm->count);
+	ft_memcpy(data + LIGHT_HEADER + sizeof(long) * lm->count, lm->samples,
+		(size_t)lm->count * LIGHT_SAMPLES);
+	status = write_file(path, data, len);
+	free(data);
+	return (status);
+}
+
+static void	lightmap_report(const t_game *game, const char *path)
+{
+	const t_lightmap	*lm;
+
+	lm = &game->light;
+	if (game->opts.headless)
+		return ;
+	if (lm->cached)
+		printf("lightmap: %d face(s) loaded from %s", lm->count, path);
+	else
+		printf("lightmap: %d face(s) baked", lm->count);
+	printf(" in %.2f ms\n", lm->bake_us / 1000.0);
+	fflush(stdout);
+}
+
+void	lightmap_build(t_game *game)
+{
+	t_lightmap	*lm;
+	const char	*path;
+
+	lm = &game->light;
+	free_lightmap(lm);
+	if (game->config.light_count == 0)
+		return ;
+	path = game->opts.light_cache;
+	lm->bake_us = now_usec();
+	lm->hash = lightmap_hash(game);
+	lm->cached = path && lightmap_cache_load(lm, path) == 0;
+	if (!lm->cached)
+	{
+		lightmap_collect(game);
+		pool_run(&game->pool, lightmap_bake_range, game, lm->count);
+		if (path && lightmap_cache_save(lm, path))
+			print_error("Failed to write the light cache");
+	}
+	lm->bake_us = now_usec() - lm->bake_us;
+	lightmap_report(game, path);
+}
@@ -0,0 +1,56 @@
+#include "cub3d.h"
+
+static unsigned long	fnv_mix(unsigned long hash, const void *data,
+			size_t len)
+{
+	const unsigned char	*bytes;
+
+	bytes = (const unsigned char *)data;
+	while (len-- > 0)
+		hash = (hash ^ *bytes++) * 0x100000001b3UL;
+	return (hash);
+}
+
+static unsigned long	hash_box(unsigned long hash, const t_map *map,
+			const t_light *light)
+{
+	int		x;
+	int		y;
+	char	c;
+
+	y = (int)fmax(light->y - light->radius - 1.0, 0.0);
+	while (y <= light->y + light->radius + 1.0 && y < map->height)
+	{
+		x = (int)fmax(light->x - light->radius - 1.0, 0.0);
+		while (x <= light->x + light->radius + 1.0 && x < map->width)
+		{
+			c = map_cell(map, x++, y);
+			hash = fnv_mix(hash, &c, 1);
+		}
+		y++;
+	}
+	return (hash);
+}
+
+unsigned long	lightmap_hash(const t_game *game)
+{
+	unsigned long	hash;
+	double			word[6];
+	int				i;
+
+	word[0] = LIGHT_VERSION;
+	word[1] = LIGHT_SAMPLES;
+	word[2] = LIGHT_AMBIENT;
+	word[3] = LIGHT_EPSILON;
+	word[4] = game->map.width;
+	word[5] = game->map.height;
+	hash = fnv_mix(0xcbf29ce484222325UL, word, sizeof(word));
+	i = 0;
+	while (i < game->config.light_count)
+	{
+		hash = fnv_mix(hash, &game->config.light[i], sizeof(t_light));
+		hash = hash_box(hash, &game->map, &game->config.light[i]);
+		i++;
+	}
+	return (hash);
+}
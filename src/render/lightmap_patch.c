@@ -0,0 +1,85 @@
+#include "cub3d.h"
+
+static int	face_lower_bound(const t_lightmap *lm, long key)
+{
+	int	lo;
+	int	hi;
+	int	mid;
+
+	lo = 0;
+	hi = lm->count;
+	while (lo < hi)
+	{
+		mid = (lo + hi) / 2;
+		if (lm->keys[mid] < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return (lo);
+}
+
+static void	splice_faces(t_lightmap *lm, const int *span, const long *keys,
+			int n)
+{
+	long			*next_keys;
+	unsigned char	*samples;
+	int				tail;
+
+	tail = lm->count - span[1];
+	next_keys = safe_malloc(sizeof(long) * (span[0] + n + tail) + 1);
+	samples = safe_malloc((size_t)(span[0] + n + tail) * LIGHT_SAMPLES + 1);
+	ft_memcpy(next_keys, lm->keys, sizeof(long) * span[0]);
+	ft_memcpy(next_keys + span[0], keys, sizeof(long) * n);
+	ft_memcpy(next_keys + span[0] + n, lm->keys + span[1],
+		sizeof(long) * tail);
+	ft_memcpy(samples, lm->samples, (size_t)span[0] * LIGHT_SAMPLES);
+	ft_memcpy(samples + (long)(span[0] + n) * LIGHT_SAMPLES,
+		lm->samples + (long)span[1] * LIGHT_SAMPLES,
+		(size_t)tail * LIGHT_SAMPLES);
+	free(lm->keys);
+	free(lm->samples);
+	lm->keys = next_keys;
+	lm->samples = samples;
+	lm->count = span[0] + n + tail;
+	lm->cap = lm->count;
+}
+
+static void	patch_cell(t_game *game, int x, int y)
+{
+	t_lightmap	*lm;
+	long		keys[TEX_COUNT];
+	int			span[2];
+	int			n;
+	int			i;
+
+	if (x < 0 || y < 0 || x >= game->map.width || y >= game->map.height)
+		return ;
+	lm = &game->light;
+	n = lightmap_faces(game, x, y, keys);
+	span[0] = face_lower_bound(lm, map_cell_key(&game->map, x, y) << 2);
+	span[1] = face_lower_bound(lm, (map_cell_key(&game->map, x, y) << 2)
+			+ TEX_COUNT);
+	i = 0;
+	while (i < n && span[0] + i < span[1] && lm->keys[span[0] + i] == keys[i])
+		i++;
+	if (i < n || n != span[1] - span[0])
+		splice_faces(lm, span, keys, n);
+	lightmap_bake_range(game, span[0], span[0] + n);
+}
+
+void	lightmap_patch(t_game *game, int x, int y)
+{
+	static const int	d[5][2] = {{0, 0}, {0, 1}, {0, -1}, {-1, 0}, {1, 0}};
+	int					i;
+
+	if (game->config.light_count == 0)
+		return ;
+	i = 0;
+	while (i < 5)
+	{
+		patch_cell(game, x + d[i][0], y + d[i][1]);
+		i++;
+	}
+	game->light.hash = lightmap_hash(game);
+}
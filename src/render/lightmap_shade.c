@@ -0,0 +1,53 @@
+#include "cub3d.h"
+
+static int	face_index(const t_lightmap *lm, long key)
+{
+	int	lo;
+	int	hi;
+	int	mid;
+
+	lo = 0;
+	hi = lm->count;
+	while (lo < hi)
+	{
+		mid = (lo + hi) / 2;
+		if (lm->keys[mid] < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo < lm->count && lm->keys[lo] == key)
+		return (lo);
+	return (-1);
+}
+
+static int	sample_lerp(const unsigned char *s, double u)
+{
+	double	pos;
+	int		i;
+
+	pos = (u - floor(u)) * LIGHT_SAMPLES - 0.5;
+	if (pos <= 0.0)
+		return (s[0]);
+	i = (int)pos;
+	if (i >= LIGHT_SAMPLES - 1)
+		return (s[LIGHT_SAMPLES - 1]);
+	return ((int)(s[i] + (s[i + 1] - s[i]) * (pos - i) + 0.5));
+}
+
+int	lightmap_level(const t_game *game, const t_ray *ray, int face)
+{
+	const t_lightmap	*lm;
+	int					i;
+
+	lm = &game->light;
+	i = face_index(lm, (map_cell_key(&game->map, ray->map_x, ray->map_y) << 2)
+			| face);
+	if (i < 0)
+		return ((int)(LIGHT_AMBIENT * LIGHT_ONE / (1 + ray->side) + 0.5));
+	if (ray->side == 0)
+		return (sample_lerp(lm->samples + (long)i * LIGHT_SAMPLES,
+				ray->org_y + ray->perp_dist * ray->dir_y));
+	return (sample_lerp(lm->samples + (long)i * LIGHT_SAMPLES,
+			ray->org_x + ray->perp_dist * ray->dir_x));
+}
@@ -0,0 +1,91 @@
+#include "cub3d.h"
+
+void	minimap_touch(t_game *game, int x, int y)
+{
+	t_minimap	*mm;
+
+	mm = &game->minimap;
+	if (!mm->valid || x < mm->origin_x || y < mm->origin_y
+		|| x >= mm->origin_x + MINI_CELLS || y >= mm->origin_y + MINI_CELLS)
+		return ;
+	if (mm->dirty_count == MINI_DIRTY)
+	{
+		mm->valid = 0;
+		return ;
+	}
+	mm->dirty[mm->dirty_count][0] = x;
+	mm->dirty[mm->dirty_count++][1] = y;
+}
+
+void	minimap_invalidate(t_game *game)
+{
+	game->minimap.valid = 0;
+	game->minimap.dirty_count = 0;
+}
+
+static int	recenter_axis(int *origin, int cell, int size)
+{
+	int	next;
+
+	next = *origin;
+	if (size <= MINI_CELLS)
+		next = (size - MINI_CELLS) / 2;
+	else if (cell - *origin < MINI_EDGE
+		|| cell - *origin >= MINI_CELLS - MINI_EDGE)
+		next = cell - MINI_CELLS / 2;
+	if (next == *origin)
+		return (0);
+	*origin = next;
+	return (1);
+}
+
+static void	minimap_update(t_game *game, t_minimap *mm)
+{
+	int	cx;
+	int	cy;
+
+	cx = (int)game->player.x;
+	cy = (int)game->player.y;
+	if (recenter_axis(&mm->origin_x, cx, game->map.width)
+		| recenter_axis(&mm->origin_y, cy, game->map.height))
+		mm->valid = 0;
+	if (!mm->valid)
+		minimap_paint_all(game);
+	else
+	{
+		while (mm->dirty_count > 0)
+		{
+			mm->dirty_count--;
+			minimap_paint_cell(game, mm->dirty[mm->dirty_count][0],
+				mm->dirty[mm->dirty_count][1]);
+		}
+		minimap_paint_cell(game, mm->player_x, mm->player_y);
+		minimap_paint_cell(game, cx, cy);
+	}
+	mm->valid = 1;
+	mm->player_x = cx;
+	mm->player_y = cy;
+	minimap_paint_player(game);
+}
+
+void	minimap_draw(t_game *game)
+{
+	t_minimap	*mm;
+
+	mm = &game->minimap;
+	if (!mm->img.addr)
+	{
+		mm->img.width = MINI_PX;
+		mm->img.height = MINI_PX;
+		mm->img.bpp = 32;
+		mm->img.line_len = MINI_PX * 4;
+		mm->img.addr = safe_malloc((long)MINI_PX * MINI_PX * 4);
+		mm->valid = 0;
+	}
+	if (game->frame.width < MINI_PX + 2 * MINI_INSET
+		|| game->frame.height < MINI_PX + 2 * MINI_INSET)
+		return ;
+	minimap_update(game, mm);
+	minimap_blit(game, &game->frame,
+		game->frame.width - MINI_PX - MINI_INSET, MINI_INSET);
+}
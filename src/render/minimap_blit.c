@@ -0,0 +1,61 @@
+#include "cub3d.h"
+
+static void	cone_edge(t_img *dst, const int *box, const double *from,
+			const double *dir)
+{
+	double	len;
+	double	x;
+	double	y;
+	int		step;
+
+	len = hypot(dir[0], dir[1]);
+	if (len == 0.0)
+		return ;
+	step = 0;
+	while (step < MINI_CONE * MINI_SCALE)
+	{
+		x = from[0] + dir[0] / len * step;
+		y = from[1] + dir[1] / len * step;
+		if (x < box[0] || y < box[1]
+			|| x >= box[0] + MINI_PX || y >= box[1] + MINI_PX)
+			return ;
+		draw_pixel(dst, (int)x, (int)y, MINI_RAY);
+		step++;
+	}
+}
+
+static void	draw_cone(t_game *game, t_img *dst, int x0, int y0)
+{
+	const t_player	*p;
+	int				box[2];
+	double			from[2];
+	double			dir[2];
+
+	p = &game->player;
+	box[0] = x0;
+	box[1] = y0;
+	from[0] = x0 + (p->x - game->minimap.origin_x) * MINI_SCALE;
+	from[1] = y0 + (p->y - game->minimap.origin_y) * MINI_SCALE;
+	dir[0] = p->dir_x - p->plane_x;
+	dir[1] = p->dir_y - p->plane_y;
+	cone_edge(dst, box, from, dir);
+	dir[0] = p->dir_x + p->plane_x;
+	dir[1] = p->dir_y + p->plane_y;
+	cone_edge(dst, box, from, dir);
+}
+
+void	minimap_blit(t_game *game, t_img *dst, int x0, int y0)
+{
+	const t_img	*src;
+	int			y;
+
+	src = &game->minimap.img;
+	y = 0;
+	while (y < src->height)
+	{
+		ft_memcpy(dst->addr + (long)(y0 + y) * dst->line_len + x0 * 4,
+			src->addr + (long)y * src->line_len, (size_t)src->width * 4);
+		y++;
+	}
+	draw_cone(game, dst, x0, y0);
+}
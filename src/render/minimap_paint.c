@@ -0,0 +1,83 @@
+#include "cub3d.h"
+
+static unsigned int	cell_color(const t_game *game, char c)
+{
+	if (c == '0')
+		return (MINI_FLOOR);
+	if (c == DOOR_CELL)
+		return (MINI_DOOR);
+	if (c > '0' && game->config.breakable[(unsigned char)c])
+		return (MINI_BREAK);
+	if (c > '0')
+		return (MINI_WALL);
+	return (MINI_VOID);
+}
+
+void	minimap_paint_cell(t_game *game, int x, int y)
+{
+	t_minimap		*mm;
+	unsigned int	color;
+	int				row;
+
+	mm = &game->minimap;
+	x -= mm->origin_x;
+	y -= mm->origin_y;
+	if (x < 0 || y < 0 || x >= MINI_CELLS || y >= MINI_CELLS)
+		return ;
+	color = cell_color(game, map_cell(&game->map, x + mm->origin_x,
+				y + mm->origin_y));
+	row = 0;
+	while (row < MINI_SCALE)
+	{
+		ft_fill32(mm->img.addr + (long)(y * MINI_SCALE + row)
+			* mm->img.line_len + x * MINI_SCALE * 4, color, MINI_SCALE);
+		row++;
+	}
+	mm->cells_painted++;
+}
+
+void	minimap_paint_all(t_game *game)
+{
+	int	x;
+	int	y;
+
+	game->minimap.dirty_count = 0;
+	game->minimap.repaints++;
+	y = 0;
+	while (y < MINI_CELLS)
+	{
+		x = 0;
+		while (x < MINI_CELLS)
+		{
+			minimap_paint_cell(game, game->minimap.origin_x + x,
+				game->minimap.origin_y + y);
+			x++;
+		}
+		y++;
+	}
+}
+
+void	minimap_paint_player(t_game *game)
+{
+	t_minimap	*mm;
+	int			px;
+	int			py;
+
+	mm = &game->minimap;
+	px = (int)((game->player.x - mm->origin_x) * MINI_SCALE);
+	py = (int)((game->player.y - mm->origin_y) * MINI_SCALE);
+	if (px > (mm->player_x - mm->origin_x + 1) * MINI_SCALE - 2)
+		px = (mm->player_x - mm->origin_x + 1) * MINI_SCALE - 2;
+	if (py > (mm->player_y - mm->origin_y + 1) * MINI_SCALE - 2)
+		py = (mm->player_y - mm->origin_y + 1) * MINI_SCALE - 2;
+	draw_pixel(&mm->img, px, py, MINI_PLAYER);
+	draw_pixel(&mm->img, px + 1, py, MINI_PLAYER);
+	draw_pixel(&mm->img, px, py + 1, MINI_PLAYER);
+	draw_pixel(&mm->img, px + 1, py + 1, MINI_PLAYER);
+}
+
+void	free_minimap(t_minimap *mm)
+{
+	free(mm->img.addr);
+	ft_bzero(mm, sizeof(t_minimap));
+}
@@ -0,0 +1,57 @@
+#include "cub3d.h"
+
+static int	door_spans_x(const t_map *map, int x, int y)
+{
+	return (map_cell(map, x - 1, y) > '0' && map_cell(map, x + 1, y) > '0');
+}
+
+static double	door_cross(const t_ray *ray, int spans_x, double *t)
+{
+	if (spans_x)
+	{
+		*t = ray->side_dist_y - 0.5 * ray->delta_dist_y;
+		if (*t > ray->side_dist_x
+			|| (ray->side == 0 && *t < ray->side_dist_x - ray->delta_dist_x))
+			return (-1.0);
+		return (ray->org_x + *t * ray->dir_x - ray->map_x);
+	}
+	*t = ray->side_dist_x - 0.5 * ray->delta_dist_x;
+	if (*t > ray->side_dist_y
+		|| (ray->side == 1 && *t < ray->side_dist_y - ray->delta_dist_y))
+		return (-1.0);
+	return (ray->org_y + *t * ray->dir_y - ray->map_y);
+}
+
+int	ray_door_hit(const t_map *map, t_ray *ray)
+{
+	const t_door	*door;
+	double			along;
+	double			t;
+	int				spans_x;
+
+	door = map_door(map, map_cell_key(map, ray->map_x, ray->map_y));
+	if (!door)
+		return (1);
+	spans_x = door_spans_x(map, ray->map_x, ray->map_y);
+	along = door_cross(ray, spans_x, &t);
+	if (along < door->open)
+		return (0);
+	ray->shift = door->open;
+	ray->side = spans_x;
+	if (spans_x)
+		ray->side_dist_y = t + ray->delta_dist_y;
+	else
+		ray->side_dist_x = t + ray->delta_dist_x;
+	return (1);
+}
+
+int	door_tex_x(const t_ray *ray, int tex_x, int width)
+{
+	int	shift;
+
+	shift = (int)(ray->shift * width);
+	if ((ray->side == 0 && ray->dir_x > 0)
+		|| (ray->side == 1 && ray->dir_y < 0))
+		return (tex_x + shift);
+	return (tex_x - shift);
+}
@@ -1,84 +1,39 @@
 #include "cub3d.h"
 
-void	ray_init(t_game *game, t_ray *ray, int x)
+static double	ray_delta(double dir)
 {
-	double	camera_x;
-
-	camera_x = 2.0 * x / (double)WIN_WIDTH - 1.0;
-	ray->dir_x = game->player.dir_x + game->player.plane_x * camera_x;
-	ray->dir_y = game->player.dir_y + game->player.plane_y * camera_x;
-	ray->map_x = (int)game->player.x;
-	ray->map_y = (int)game->player.y;
-	if (ray->dir_x == 0)
-		ray->delta_dist_x = 1e30;
-	else
-		ray->delta_dist_x = fabs(1.0 / ray->dir_x);
-	if (ray->dir_y == 0)
-		ray->delta_dist_y = 1e30;
-	else
-		ray->delta_dist_y = fabs(1.0 / ray->dir_y);
+	if (dir == 0)
+		return (1e30);
+	return (fabs(1.0 / dir));
 }
 
-void	ray_set_step(t_game *game, t_ray *ray)
+void	ray_prepare(t_ray *ray, double origin_x, double origin_y)
 {
+	ray->map_x = (int)floor(origin_x);
+	ray->map_y = (int)floor(origin_y);
+	ray->org_x = origin_x;
+	ray->org_y = origin_y;
+	ray->delta_dist_x = ray_delta(ray->dir_x);
+	ray->delta_dist_y = ray_delta(ray->dir_y);
+	ray->step_x = 1;
+	ray->side_dist_x = (ray->map_x + 1.0 - origin_x) * ray->delta_dist_x;
 	if (ray->dir_x < 0)
 	{
 		ray->step_x = -1;
-		ray->side_dist_x = (game->player.x - ray->map_x) * ray->delta_dist_x;
-	}
-	else
-	{
-		ray->step_x = 1;
-		ray->side_dist_x = (ray->map_x + 1.0 - game->player.x)
-			* ray->delta_dist_x;
+		ray->side_dist_x = (origin_x - ray->map_x) * ray->delta_dist_x;
 	}
+	ray->step_y = 1;
+	ray->side_dist_y = (ray->map_y + 1.0 - origin_y) * ray->delta_dist_y;
 	if (ray->dir_y < 0)
 	{
 		ray->step_y = -1;
-		ray->side_dist_y = (game->player.y - ray->map_y) * ray->delta_dist_y;
-	}
-	else
-	{
-		ray->step_y = 1;
-		ray->side_dist_y = (ray->map_y + 1.0 - game->player.y)
-			* ray->delta_dist_y;
+		ray->side_dist_y = (origin_y - ray->map_y) * ray->delta_dist_y;
 	}
 }
 
-static int	ray_advance_cell(t_game *game, t_ray *ray)
+void	ray_init(t_view *view, t_ray *ray, double camera_x)
 {
-	if (ray->side_dist_x < ray->side_dist_y)
-	{
-		ray->side_dist_x += ray->delta_dist_x;
-		ray->map_x += ray->step_x;
-		ray->side = 0;
-	}
-	else
-	{
-		ray->side_dist_y += ray->delta_dist_y;
-		ray->map_y += ray->step_y;
-		ray->side = 1;
-	}
-	if (ray->map_y < 0 || ray->map_y >= game->map.height
-		|| ray->map_x < 0 || ray->map_x >= game->map.width)
-		return (-1);
-	if (game->map.grid[ray->map_y][ray->map_x] == '1')
-		return (1);
-	return (0);
-}
-
-int	ray_step_until_hit(t_game *game, t_ray *ray)
-{
-	int	status;
-
-	status = ray_advance_cell(game, ray);
-	while (status == 0)
-		status = ray_advance_cell(game, ray);
-	if (status < 0)
-		return (-1);
-	if (ray->side == 0)
-		ray->perp_dist = ray->side_dist_x - ray->delta_dist_x;
-	else
-		ray->perp_dist = ray->side_dist_y - ray->delta_dist_y;
-	return (0);
+	ray->dir_x = view->cam.dir_x + view->cam.plane_x * camera_x;
+	ray->dir_y = view->cam.dir_y + view->cam.plane_y * camera_x;
+	ray_prepare(ray, view->cam.x, view->cam.y);
 }
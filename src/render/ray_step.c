@@ -0,0 +1,66 @@
+#include "cub3d.h"
+
+static int	ray_cell_status(const t_map *map, t_ray *ray)
+{
+	const char	*chunk;
+
+	if (ray->map_y < 0 || ray->map_y >= map->height
+		|| ray->map_x < 0 || ray->map_x >= map->width)
+		return (-1);
+	chunk = map->chunks[(long)(ray->map_y >> CHUNK_SHIFT) * map->chunk_cols
+		+ (ray->map_x >> CHUNK_SHIFT)];
+	ray->cell = chunk[((ray->map_y & CHUNK_MASK) << CHUNK_SHIFT)
+		| (ray->map_x & CHUNK_MASK)];
+	if (ray->cell <= '0')
+		return (0);
+	if (ray->cell == DOOR_CELL)
+		return (ray_door_hit(map, ray));
+	return (1);
+}
+
+int	ray_advance_cell(const t_map *map, t_ray *ray)
+{
+	if (ray->side_dist_x < ray->side_dist_y)
+	{
+		ray->side_dist_x += ray->delta_dist_x;
+		ray->map_x += ray->step_x;
+		ray->side = 0;
+	}
+	else
+	{
+		ray->side_dist_y += ray->delta_dist_y;
+		ray->map_y += ray->step_y;
+		ray->side = 1;
+	}
+	return (ray_cell_status(map, ray));
+}
+
+int	ray_step_until_hit(const t_map *map, t_ray *ray, t_dda_stats *stats)
+{
+	int	status;
+	int	steps;
+
+	if (stats)
+		return (dda_step_counted(map, ray, stats));
+	steps = 1;
+	status = ray_advance_cell(map, ray);
+	while (status == 0)
+	{
+		if (ray->side_dist_x >= ray->limit && ray->side_dist_y >= ray->limit)
+			return (-1);
+		status = ray_advance_cell(map, ray);
+		steps++;
+	}
+	if (status < 0)
+		return (-1);
+	return (ray_finish_hit(ray, steps));
+}
+
+int	ray_finish_hit(t_ray *ray, int steps)
+{
+	if (ray->side == 0)
+		ray->perp_dist = ray->side_dist_x - ray->delta_dist_x;
+	else
+		ray->perp_dist = ray->side_dist_y - ray->delta_dist_y;
+	return (steps);
+}
@@ -1,46 +1,77 @@
 #include "cub3d.h"
 
-static void	draw_wall(t_game *game, int x, t_ray *ray)
+static t_img	*wall_texture(t_game *game, t_view *view, t_ray *ray,
+					t_column *col)
 {
 	t_img	*tex;
-	t_column	col;
+	int		face;
 
-	if (ray->perp_dist <= 0)
-		ray->perp_dist = 0.0001;
-	col.line_height = (int)(WIN_HEIGHT / ray->perp_dist);
-	compute_wall_limits(col.line_height, &col.start, &col.end);
-	tex = &game->texture[select_texture_index(game, ray)];
-	col.tex_x = compute_tex_x(game, ray, tex);
-	if (col.tex_x < 0)
-		col.tex_x = 0;
-	if (col.tex_x >= tex->width)
-		col.tex_x = tex->width - 1;
-	col.x = x;
-	draw_texture_column(game, ray, tex, &col);
+	face = select_texture_index(game, ray);
+	tex = game->face[ray->cell * TEX_COUNT + face];
+	col->tex_x = compute_tex_x(view, ray, tex);
+	if (ray->cell == DOOR_CELL)
+		col->tex_x = door_tex_x(ray, col->tex_x, tex->width);
+	if (col->tex_x < 0)
+		col->tex_x = 0;
+	if (col->tex_x >= tex->width)
+		col->tex_x = tex->width - 1;
+	col->light = -1;
+	if (game->config.light_count)
+		col->light = lightmap_level(game, ray, face);
+	return (tex);
 }
 
-static void	render_column(t_game *game, int x)
+void	render_wall(t_game *game, t_view *view, int x, t_ray *ray)
 {
-	t_ray	ray;
+	t_img		*tex;
+	t_column	col;
 
-	ray_init(game, &ray, x);
-	ray_set_step(game, &ray);
-	if (ray_step_until_hit(game, &ray) < 0)
+	if (ray->perp_dist <= 0)
+		ray->perp_dist = 0.0001;
+	fog_column(&game->fog, &col, ray->perp_dist);
+	if (col.fog == 256)
 		return ;
-	if (ray.perp_dist > 0)
-		draw_wall(game, x, &ray);
+	col.line_height = (int)(view->target->height / ray->perp_dist);
+	if (game->reproj.capture && view->target == &game->frame)
+		reproj_store(game, x, ray, col.line_height);
+	compute_wall_limits(col.line_height, view->target->height,
+		&col.start, &col.end);
+	tex = wall_texture(game, view, ray, &col);
+	col.x = x;
+	draw_texture_column(view, ray, tex, &col);
 }
 
-void	render_frame(t_game *game)
+void	render_view_span(t_game *game, t_view *view, int x0, int x1)
 {
-	int	x;
+	t_ray	rays[VIEW_STRIP];
+	int		steps[VIEW_STRIP];
+	t_span	span;
+	long	total;
 
-	render_background(game);
-	x = 0;
-	while (x < WIN_WIDTH)
+	span.rays = rays;
+	span.steps = steps;
+	total = 0;
+	while (x0 < x1)
 	{
-		render_column(game, x);
-		x++;
+		span.x0 = x0;
+		span.x1 = x0 + VIEW_STRIP;
+		if (span.x1 > x1)
+			span.x1 = x1;
+		span_cast(game, view, &span);
+		while (x0 < span.x1)
+		{
+			if (steps[x0 - span.x0] >= 0)
+				total += steps[x0 - span.x0];
+			if (steps[x0 - span.x0] >= 0 && rays[x0 - span.x0].perp_dist > 0)
+				render_wall(game, view, x0, &rays[x0 - span.x0]);
+			x0++;
+		}
 	}
-	mlx_put_image_to_window(game->mlx, game->win, game->frame.ptr, 0, 0);
+	__atomic_fetch_add(&view->steps, total, __ATOMIC_RELAXED);
+}
+
+void	render_view(t_game *game, t_view *view)
+{
+	render_background(game, view->target, 0, view->target->width);
+	render_view_span(game, view, 0, view->target->width);
 }
@@ -0,0 +1,95 @@
+#include "cub3d.h"
+
+static int	reproj_alloc(t_game *game, t_reproj *rp)
+{
+	int	w;
+
+	if (rp->prev.addr)
+		return (0);
+	w = game->frame.width;
+	if (view_target_init(game, &rp->prev, w, game->frame.height))
+	{
+		game->opts.reproject = 0;
+		return (1);
+	}
+	rp->cols = safe_malloc(sizeof(t_reproj_col) * w);
+	rp->next = safe_malloc(sizeof(t_reproj_col) * w);
+	rp->src = safe_malloc(sizeof(int) * w);
+	rp->runs = safe_malloc(sizeof(int) * w * 3);
+	rp->depth = safe_malloc(sizeof(double) * w);
+	ft_bzero(rp->cols, sizeof(t_reproj_col) * w);
+	return (0);
+}
+
+static int	reproj_moved(const t_reproj *rp, const t_player *cam)
+{
+	double	dx;
+	double	dy;
+	double	turn;
+
+	dx = cam->x - rp->cam.x;
+	dy = cam->y - rp->cam.y;
+	turn = atan2(rp->cam.dir_x * cam->dir_y - rp->cam.dir_y * cam->dir_x,
+			rp->cam.dir_x * cam->dir_x + rp->cam.dir_y * cam->dir_y);
+	return (dx * dx + dy * dy > REPROJ_MOVE * REPROJ_MOVE
+		|| fabs(turn) > REPROJ_TURN);
+}
+
+static void	reproj_commit(t_game *game, t_reproj *rp, const t_view *view)
+{
+	t_reproj_col	*swap;
+
+	swap = rp->cols;
+	rp->cols = rp->next;
+	rp->next = swap;
+	rp->cam = view->cam;
+	rp->valid = !game->map.doors.moving_count;
+	rp->keep[0] = 0;
+	if (game->hud.visible)
+		rp->keep[0] = HUD_PANEL_W;
+	rp->keep[1] = game->frame.width;
+	if (game->minimap.visible)
+		rp->keep[1] -= MINI_PX + MINI_INSET;
+	rp->frames++;
+	rp->columns += game->frame.width;
+}
+
+void	reproj_render(t_game *game, t_view *view)
+{
+	t_reproj	*rp;
+	int			x;
+
+	rp = &game->reproj;
+	if (reproj_alloc(game, rp))
+	{
+		render_views(game, view, 1);
+		return ;
+	}
+	rp->capture = 1;
+	if (!rp->valid || game->map.doors.moving_count
+		|| reproj_moved(rp, &view->cam) || !reproj_frame(game, view))
+	{
+		x = 0;
+		while (x < game->frame.width)
+			rp->next[x++].valid = 0;
+		render_views(game, view, 1);
+		rp->full++;
+	}
+	rp->capture = 0;
+	reproj_commit(game, rp, view);
+}
+
+void	free_reproj(t_game *game)
+{
+	t_reproj	*rp;
+
+	rp = &game->reproj;
+	if (rp->prev.addr)
+		release_image(game, &rp->prev);
+	free(rp->cols);
+	free(rp->next);
+	free(rp->src);
+	free(rp->runs);
+	free(rp->depth);
+	ft_bzero(rp, sizeof(t_reproj));
+}
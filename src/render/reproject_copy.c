@@ -0,0 +1,78 @@
+#include "cub3d.h"
+
+static void	copy_run(unsigned int *dst, const unsigned int *src,
+				const int *run, unsigned int color)
+{
+	int	k;
+
+	k = 0;
+	if (run[1] < 0)
+		while (k < run[2])
+			dst[run[0] + k++] = color;
+	else if (run[2] >= REPROJ_MEMCPY)
+		ft_memcpy(dst + run[0], src + run[1], run[2] * 4);
+	else
+	{
+		while (k < run[2])
+		{
+			dst[run[0] + k] = src[run[1] + k];
+			k++;
+		}
+	}
+}
+
+void	reproj_copy_rows(void *ctx, int begin, int end)
+{
+	t_game			*game;
+	t_reproj		*rp;
+	unsigned int	color;
+	int				r;
+
+	game = (t_game *)ctx;
+	rp = &game->reproj;
+	while (begin < end)
+	{
+		color = background_color(game, &game->frame, begin,
+				game->frame.height / 2);
+		r = 0;
+		while (r < rp->run_count)
+			copy_run((unsigned int *)(game->frame.addr
+					+ (long)begin * game->frame.line_len),
+				(const unsigned int *)(rp->prev.addr
+					+ (long)begin * rp->prev.line_len),
+				rp->runs + r++ * 3, color);
+		begin++;
+	}
+}
+
+void	reproj_holes(void *ctx, int begin, int end)
+{
+	t_view_run	*run;
+	const int	*hole;
+
+	run = (t_view_run *)ctx;
+	while (begin < end)
+	{
+		hole = run->game->reproj.runs + begin * 3;
+		if (hole[1] < 0)
+			render_view_span(run->game, run->views, hole[0],
+				hole[0] + hole[2]);
+		begin++;
+	}
+}
+
+void	reproj_store(t_game *game, int x, const t_ray *ray, int height)
+{
+	t_reproj_col	*col;
+
+	col = &game->reproj.next[x];
+	col->hit_x = ray->org_x + ray->perp_dist * ray->dir_x;
+	col->hit_y = ray->org_y + ray->perp_dist * ray->dir_y;
+	col->height = height;
+	col->valid = (ray->cell != DOOR_CELL);
+}
+
+void	reproj_invalidate(t_game *game)
+{
+	game->reproj.valid = 0;
+}
@@ -0,0 +1,112 @@
+#include "cub3d.h"
+
+static void	reproj_place(t_game *game, int i, const t_player *cam, double inv)
+{
+	t_reproj	*rp;
+	double		d[2];
+	double		t[2];
+	int			x;
+	int			err;
+
+	rp = &game->reproj;
+	d[0] = rp->cols[i].hit_x - cam->x;
+	d[1] = rp->cols[i].hit_y - cam->y;
+	t[0] = inv * (cam->dir_y * d[0] - cam->dir_x * d[1]);
+	t[1] = inv * (cam->plane_x * d[1] - cam->plane_y * d[0]);
+	if (!(t[1] >= REPROJ_NEAR))
+		return ;
+	x = (int)floor(game->frame.width / 2.0 * (1.0 + t[0] / t[1]) + 0.5);
+	if (x < 0 || x >= game->frame.width || t[1] >= rp->depth[x])
+		return ;
+	rp->depth[x] = t[1];
+	err = abs((int)(game->frame.height / t[1]) - rp->cols[i].height);
+	rp->src[x] = -1;
+	if (err <= game->opts.reproject)
+		rp->src[x] = i;
+}
+
+static int	reproj_project(t_game *game, const t_player *cam)
+{
+	t_reproj	*rp;
+	double		inv;
+	int			i;
+	int			hits;
+
+	rp = &game->reproj;
+	inv = 1.0 / (cam->plane_x * cam->dir_y - cam->dir_x * cam->plane_y);
+	i = 0;
+	while (i < game->frame.width)
+	{
+		rp->src[i] = -1;
+		rp->depth[i++] = FOG_OFF;
+	}
+	i = rp->keep[0] - 1;
+	while (++i < rp->keep[1])
+		if (rp->cols[i].valid)
+			reproj_place(game, i, cam, inv);
+	hits = 0;
+	i = 0;
+	while (i < game->frame.width)
+		hits += (rp->src[i++] >= 0);
+	return (hits * REPROJ_MIN_SHARE >= game->frame.width);
+}
+
+static int	reproj_run(t_reproj *rp, int x, int w)
+{
+	int	len;
+
+	len = 1;
+	while (x + len < w && ((rp->src[x] < 0 && rp->src[x + len] < 0)
+			|| (rp->src[x] >= 0 && rp->src[x + len] == rp->src[x] + len)))
+		len++;
+	return (len);
+}
+
+static void	reproj_runs(t_reproj *rp, int w)
+{
+	int	*run;
+	int	x;
+	int	k;
+
+	rp->run_count = 0;
+	x = 0;
+	while (x < w)
+	{
+		run = rp->runs + rp->run_count++ * 3;
+		run[0] = x;
+		run[1] = rp->src[x];
+		run[2] = reproj_run(rp, x, w);
+		k = 0;
+		while (k < run[2] && run[1] < 0)
+			rp->next[x + k++].valid = 0;
+		while (k < run[2] && run[1] >= 0)
+		{
+			rp->next[x + k] = rp->cols[run[1] + k];
+			k++;
+		}
+		if (run[1] >= 0)
+			rp->copied += run[2];
+		x += run[2];
+	}
+}
+
+int	reproj_frame(t_game *game, t_view *view)
+{
+	t_reproj	*rp;
+	t_view_run	run;
+	t_img		swap;
+
+	rp = &game->reproj;
+	if (!reproj_project(game, &view->cam))
+		return (0);
+	swap = game->frame;
+	game->frame = rp->prev;
+	rp->prev = swap;
+	reproj_runs(rp, game->frame.width);
+	pool_run(&game->pool, reproj_copy_rows, game, game->frame.height);
+	run.game = game;
+	run.views = view;
+	run.first_strip = NULL;
+	pool_run(&game->pool, reproj_holes, &run, rp->run_count);
+	return (1);
+}
@@ -0,0 +1,90 @@
+#include "cub3d.h"
+
+static int	cast_column(t_game *game, t_view *view, t_ray *ray, int x)
+{
+	ray_init(view, ray, view_camera_x(game, view->target->width, x));
+	ray->limit = game->fog.limit;
+	return (ray_step_until_hit(&game->map, ray, view->stats));
+}
+
+static int	span_joins(const t_span *span, int a, int b)
+{
+	const t_ray	*ra;
+	const t_ray	*rb;
+
+	ra = &span->rays[a - span->x0];
+	rb = &span->rays[b - span->x0];
+	return (span->steps[a - span->x0] > 0 && span->steps[b - span->x0] > 0
+		&& ra->cell != DOOR_CELL && ra->side == rb->side
+		&& ra->map_x == rb->map_x && ra->map_y == rb->map_y
+		&& ra->step_x == rb->step_x && ra->step_y == rb->step_y);
+}
+
+static int	span_fill(t_game *game, t_view *view, t_span *span, int *ab)
+{
+	t_ray	*hit;
+	t_ray	*ray;
+	int		x;
+
+	hit = &span->rays[ab[0] - span->x0];
+	if (!span_region(&game->map, hit, &span->rays[ab[1] - span->x0],
+			(long)(ab[1] - ab[0] - 1) * span->steps[ab[0] - span->x0] * 2))
+		return (0);
+	x = ab[0] + 1;
+	while (x < ab[1])
+	{
+		ray = &span->rays[x - span->x0];
+		ray_init(view, ray, view_camera_x(game, view->target->width, x));
+		ray->limit = game->fog.limit;
+		span->steps[x - span->x0] = span_hit(hit, ray);
+		if (span->steps[x - span->x0] < 0)
+			span->steps[x - span->x0] = ray_step_until_hit(&game->map, ray,
+					NULL);
+		x++;
+	}
+	return (1);
+}
+
+static void	span_split(t_game *game, t_view *view, t_span *span, int *ab)
+{
+	int	m;
+	int	left[2];
+
+	while (ab[1] - ab[0] > 1)
+	{
+		if (span_joins(span, ab[0], ab[1]) && span_fill(game, view, span, ab))
+			return ;
+		m = (ab[0] + ab[1]) / 2;
+		span->steps[m - span->x0] = cast_column(game, view,
+				&span->rays[m - span->x0], m);
+		left[0] = ab[0];
+		left[1] = m;
+		span_split(game, view, span, left);
+		ab[0] = m;
+	}
+}
+
+void	span_cast(t_game *game, t_view *view, t_span *span)
+{
+	int	ab[2];
+	int	x;
+
+	x = span->x0;
+	if (view->stats || game->opts.no_spans)
+	{
+		while (x < span->x1)
+		{
+			span->steps[x - span->x0] = cast_column(game, view,
+					&span->rays[x - span->x0], x);
+			x++;
+		}
+		return ;
+	}
+	ab[0] = span->x0;
+	ab[1] = span->x1 - 1;
+	span->steps[0] = cast_column(game, view, &span->rays[0], ab[0]);
+	if (ab[1] > ab[0])
+		span->steps[ab[1] - ab[0]] = cast_column(game, view,
+				&span->rays[ab[1] - ab[0]], ab[1]);
+	span_split(game, view, span, ab);
+}
@@ -0,0 +1,49 @@
+#include "cub3d.h"
+
+static double	cross_dist(const t_ray *hit, const t_ray *ray, double *delta)
+{
+	double	dist;
+	int		n;
+
+	n = abs(hit->map_x - ray->map_x);
+	dist = ray->side_dist_x;
+	*delta = ray->delta_dist_x;
+	if (hit->side == 1)
+	{
+		n = abs(hit->map_y - ray->map_y);
+		dist = ray->side_dist_y;
+		*delta = ray->delta_dist_y;
+	}
+	while (n-- > 0)
+		dist += *delta;
+	return (dist);
+}
+
+int	span_hit(const t_ray *hit, t_ray *ray)
+{
+	double	dist;
+	double	delta;
+	double	edge;
+	int		n;
+
+	if (ray->step_x != hit->step_x || ray->step_y != hit->step_y)
+		return (-1);
+	dist = cross_dist(hit, ray, &delta);
+	if (hit->side == 0)
+		edge = ray->org_y + (dist - delta) * ray->dir_y - hit->map_y;
+	else
+		edge = ray->org_x + (dist - delta) * ray->dir_x - hit->map_x;
+	if (!(edge >= SPAN_EPS && edge <= 1.0 - SPAN_EPS)
+		|| dist - delta >= ray->limit)
+		return (-1);
+	n = abs(hit->map_x - ray->map_x) + abs(hit->map_y - ray->map_y);
+	ray->map_x = hit->map_x;
+	ray->map_y = hit->map_y;
+	ray->side = hit->side;
+	ray->cell = hit->cell;
+	if (ray->side == 0)
+		ray->side_dist_x = dist;
+	else
+		ray->side_dist_y = dist;
+	return (ray_finish_hit(ray, n));
+}
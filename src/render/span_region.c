@@ -0,0 +1,86 @@
+#include "cub3d.h"
+
+static double	across_hit(const t_ray *ray)
+{
+	if (ray->side == 0)
+		return (ray->org_y + ray->perp_dist * ray->dir_y);
+	return (ray->org_x + ray->perp_dist * ray->dir_x);
+}
+
+static int	slab_clear(const t_map *map, int side, int along,
+				const double *range)
+{
+	int	lo;
+	int	hi;
+	int	x;
+	int	y;
+
+	lo = (int)floor(range[0] - SPAN_EPS);
+	hi = (int)floor(range[1] + SPAN_EPS);
+	while (lo <= hi)
+	{
+		x = along;
+		y = lo++;
+		if (side == 1)
+		{
+			x = y;
+			y = along;
+		}
+		if (x < 0 || y < 0 || x >= map->width || y >= map->height
+			|| map_cell(map, x, y) > '0')
+			return (0);
+	}
+	return (1);
+}
+
+static void	slab_range(const double *tri, int cell, double *range)
+{
+	double	u[2];
+
+	u[0] = (fmax(cell, fmin(tri[0], tri[1])) - tri[0]) / (tri[1] - tri[0]);
+	u[1] = (fmin(cell + 1, fmax(tri[0], tri[1])) - tri[0]) / (tri[1] - tri[0]);
+	range[0] = tri[2] + fmin(fmin(u[0] * tri[3], u[0] * tri[4]),
+			fmin(u[1] * tri[3], u[1] * tri[4]));
+	range[1] = tri[2] + fmax(fmax(u[0] * tri[3], u[0] * tri[4]),
+			fmax(u[1] * tri[3], u[1] * tri[4]));
+}
+
+static void	slab_axis(const t_ray *a, const t_ray *b, double *tri, int *walk)
+{
+	walk[0] = (int)a->org_x;
+	walk[1] = (int)a->step_x;
+	walk[2] = a->map_x;
+	tri[0] = a->org_x;
+	tri[2] = a->org_y;
+	if (a->side == 1)
+	{
+		walk[0] = (int)a->org_y;
+		walk[1] = (int)a->step_y;
+		walk[2] = a->map_y;
+		tri[0] = a->org_y;
+		tri[2] = a->org_x;
+	}
+	tri[1] = walk[2] + (walk[1] < 0);
+	tri[3] = across_hit(a) - tri[2];
+	tri[4] = across_hit(b) - tri[2];
+}
+
+int	span_region(const t_map *map, const t_ray *a, const t_ray *b,
+		long budget)
+{
+	double	tri[5];
+	double	range[2];
+	int		walk[3];
+
+	slab_axis(a, b, tri, walk);
+	while (walk[0] != walk[2])
+	{
+		slab_range(tri, walk[0], range);
+		budget -= (long)(range[1] - range[0]) + 2;
+		if (budget < 0 || !slab_clear(map, a->side, walk[0], range))
+			return (0);
+		walk[0] += walk[1];
+	}
+	return (1);
+}
+
@@ -0,0 +1,81 @@
+#include "cub3d.h"
+
+static void	render_strips(void *ctx, int begin, int end)
+{
+	t_view_run	*run;
+	int			v;
+	int			x0;
+	int			x1;
+
+	run = (t_view_run *)ctx;
+	v = 0;
+	while (begin < end)
+	{
+		while (begin >= run->first_strip[v + 1])
+			v++;
+		x0 = (begin - run->first_strip[v]) * VIEW_STRIP;
+		x1 = x0 + VIEW_STRIP;
+		if (x1 > run->views[v].target->width)
+			x1 = run->views[v].target->width;
+		render_background(run->game, run->views[v].target, x0, x1);
+		render_view_span(run->game, &run->views[v], x0, x1);
+		begin++;
+	}
+}
+
+void	render_views(t_game *game, t_view *views, int count)
+{
+	t_view_run	run;
+	int			strips[8];
+	int			v;
+
+	if (count <= 0)
+		return ;
+	run.first_strip = strips;
+	if (count + 1 > 8)
+		run.first_strip = safe_malloc(sizeof(int) * (count + 1));
+	run.game = game;
+	run.views = views;
+	run.first_strip[0] = 0;
+	v = 0;
+	while (v < count)
+	{
+		run.first_strip[v + 1] = run.first_strip[v]
+			+ (views[v].target->width + VIEW_STRIP - 1) / VIEW_STRIP;
+		v++;
+	}
+	pool_run(&game->pool, render_strips, &run, run.first_strip[count]);
+	if (run.first_strip != strips)
+		free(run.first_strip);
+}
+
+int	view_target_init(t_game *game, t_img *img, int width, int height)
+{
+	ft_bzero(img, sizeof(t_img));
+	img->width = width;
+	img->height = height;
+	if (!game->mlx)
+	{
+		img->bpp = 32;
+		img->line_len = width * 4;
+		img->addr = safe_malloc((size_t)width * height * 4);
+		return (0);
+	}
+	img->ptr = mlx_new_image(game->mlx, width, height);
+	if (!img->ptr)
+		return (print_error("Failed to create view image"));
+	img->addr = mlx_get_data_addr(img->ptr, &img->bpp, &img->line_len,
+			&img->endian);
+	return (0);
+}
+
+void	camera_set_plane(t_player *cam, double plane_len)
+{
+	double	len;
+
+	len = sqrt(cam->dir_x * cam->dir_x + cam->dir_y * cam->dir_y);
+	if (len <= 0)
+		return ;
+	cam->plane_x = -cam->dir_y / len * plane_len;
+	cam->plane_y = cam->dir_x / len * plane_len;
+}
@@ -0,0 +1,92 @@
+#include "cub3d.h"
+
+char	*xpm_next_string(char *cursor, char **end)
+{
+	while (*cursor && *cursor != '"')
+		cursor++;
+	if (!*cursor)
+		return (NULL);
+	cursor++;
+	*end = cursor;
+	while (**end && **end != '"')
+		(*end)++;
+	if (!**end)
+		return (NULL);
+	return (cursor);
+}
+
+static int	parse_header(char *str, int *values)
+{
+	int	i;
+
+	i = 0;
+	while (i < 4)
+	{
+		while (*str == ' ' || *str == '\t')
+			str++;
+		if (!ft_is_digit(*str))
+			return (-1);
+		values[i] = 0;
+		while (ft_is_digit(*str))
+			values[i] = values[i] * 10 + (*str++ - '0');
+		i++;
+	}
+	if (values[0] <= 0 || values[1] <= 0 || values[2] <= 0
+		|| values[3] <= 0 || values[3] > 2)
+		return (-1);
+	return (0);
+}
+
+static char	*decode_pixels(t_img *img, char *cursor, int *table, int cpp)
+{
+	char	*str;
+	char	*end;
+	int		*row;
+	int		x;
+	int		y;
+
+	y = -1;
+	while (++y < img->height)
+	{
+		str = xpm_next_string(cursor, &end);
+		if (!str || end - str < (long)img->width * cpp)
+			return (NULL);
+		row = (int *)(img->addr + (long)y * img->line_len);
+		x = -1;
+		while (++x < img->width)
+		{
+			if (cpp == 1)
+				row[x] = table[(unsigned char)str[x]];
+			else
+				row[x] = table[((unsigned char)str[x * 2] << 8)
+					| (unsigned char)str[x * 2 + 1]];
+		}
+		cursor = end + 1;
+	}
+	return (cursor);
+}
+
+int	xpm_decode(t_img *img, char *data)
+{
+	char	*str;
+	char	*end;
+	int		hdr[4];
+	int		*table;
+
+	str = xpm_next_string(data, &end);
+	if (!str || parse_header(str, hdr))
+		return (print_error("Unsupported XPM header"));
+	table = ft_calloc(65536, sizeof(int));
+	str = xpm_read_colors(end + 1, hdr, table);
+	img->width = hdr[0];
+	img->height = hdr[1];
+	img->bpp = 32;
+	img->line_len = hdr[0] * 4;
+	img->addr = safe_malloc((long)img->line_len * img->height);
+	if (str)
+		str = decode_pixels(img, str, table, hdr[3]);
+	free(table);
+	if (!str)
+		return (print_error("Corrupt XPM data"));
+	return (0);
+}
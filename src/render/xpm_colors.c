@@ -0,0 +1,46 @@
+#include "cub3d.h"
+
+static int	parse_color_value(char *str, char *end)
+{
+	int	color;
+
+	while (str + 2 < end && !(str[0] == 'c' && ft_is_space(str[1])))
+		str++;
+	str += 2;
+	while (str < end && ft_is_space(*str))
+		str++;
+	if (*str != '#')
+		return ((int)0xFF000000);
+	color = 0;
+	while (++str < end && !ft_is_space(*str))
+	{
+		color <<= 4;
+		if (ft_is_digit(*str))
+			color |= *str - '0';
+		else
+			color |= ((*str | 32) - 'a' + 10) & 0xF;
+	}
+	return (color & 0xFFFFFF);
+}
+
+char	*xpm_read_colors(char *cursor, const int *hdr, int *table)
+{
+	char	*str;
+	char	*end;
+	int		i;
+
+	i = 0;
+	while (i++ < hdr[2])
+	{
+		str = xpm_next_string(cursor, &end);
+		if (!str || end - str < hdr[3])
+			return (NULL);
+		if (hdr[3] == 1)
+			table[(unsigned char)str[0]] = parse_color_value(str + 1, end);
+		else
+			table[((unsigned char)str[0] << 8) | (unsigned char)str[1]]
+				= parse_color_value(str + 2, end);
+		cursor = end + 1;
+	}
+	return (cursor);
+}
@@ -0,0 +1,21 @@
+#include "cub3d.h"
+
+int	run_headless_replay(t_game *game)
+{
+	t_hist	frames;
+	long	start;
+	long	total;
+
+	ft_bzero(&frames, sizeof(t_hist));
+	total = now_usec();
+	while (!trace_apply(game))
+	{
+		start = now_usec();
+		update_game_state(game);
+		game->tick++;
+		render_frame(game);
+		hist_add(&frames, now_usec() - start);
+	}
+	print_bench_report(game, &frames, now_usec() - total);
+	return (0);
+}
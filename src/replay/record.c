@@ -0,0 +1,64 @@
+#include "cub3d.h"
+
+static void	put_event(t_trace *trace, long tick, int id, int pressed)
+{
+	unsigned char	code;
+	long			usec;
+
+	usec = now_usec();
+	trace_put_varint(trace, (unsigned long)(tick - trace->last_tick));
+	code = (unsigned char)((id << 1) | (pressed != 0));
+	trace_put(trace, &code, 1);
+	trace_put_varint(trace, (unsigned long)(usec - trace->last_usec));
+	trace->last_tick = tick;
+	trace->last_usec = usec;
+}
+
+int	trace_start_record(t_game *game, const char *path)
+{
+	t_trace	*trace;
+
+	trace = &game->trace;
+	trace->mode = TRACE_RECORD;
+	trace->path = path;
+	trace->len = 0;
+	trace_put(trace, TRACE_MAGIC, 4);
+	trace_put(trace, "\x01", 1);
+	trace_put(trace, &game->player, sizeof(t_player));
+	trace->last_tick = game->tick;
+	trace->last_usec = now_usec();
+	return (0);
+}
+
+void	trace_record_key(t_game *game, int keycode, int pressed)
+{
+	int	id;
+
+	if (game->trace.mode != TRACE_RECORD)
+		return ;
+	id = trace_key_id(keycode);
+	if (id < 0)
+		return ;
+	put_event(&game->trace, game->tick, id, pressed);
+}
+
+int	trace_finish(t_game *game)
+{
+	t_trace	*trace;
+	int		status;
+
+	trace = &game->trace;
+	status = 0;
+	if (trace->mode == TRACE_RECORD)
+	{
+		put_event(trace, game->tick, TRACE_END, 0);
+		if (write_file(trace->path, trace->data, trace->len))
+			status = print_error("Failed to write input trace");
+	}
+	free(trace->data);
+	trace->data = NULL;
+	trace->len = 0;
+	trace->cap = 0;
+	trace->mode = TRACE_OFF;
+	return (status);
+}
@@ -0,0 +1,61 @@
+#include "cub3d.h"
+
+static int	read_next_event(t_trace *trace)
+{
+	unsigned long	delta;
+	unsigned long	usec;
+	unsigned char	code;
+
+	if (trace_get_varint(trace, &delta) || trace->pos >= trace->len)
+		return (-1);
+	code = trace->data[trace->pos++];
+	if (trace_get_varint(trace, &usec))
+		return (-1);
+	trace->next_tick = trace->last_tick + (long)delta;
+	trace->last_tick = trace->next_tick;
+	trace->next_id = code >> 1;
+	trace->next_pressed = code & 1;
+	return (0);
+}
+
+int	trace_load(t_game *game, const char *path)
+{
+	t_trace	*trace;
+	size_t	len;
+
+	trace = &game->trace;
+	trace->data = (unsigned char *)read_file(path, &len);
+	if (!trace->data)
+		return (print_error("Unable to open input trace"));
+	trace->len = len;
+	trace->cap = len;
+	if (len < 5 + sizeof(t_player) || ft_strncmp((char *)trace->data,
+			TRACE_MAGIC, 4) || trace->data[4] != 1)
+		return (print_error("Invalid input trace"));
+	ft_memcpy(&game->player, trace->data + 5, sizeof(t_player));
+	trace->pos = 5 + sizeof(t_player);
+	trace->path = path;
+	trace->mode = TRACE_REPLAY;
+	trace->last_tick = 0;
+	if (read_next_event(trace))
+		return (print_error("Truncated input trace"));
+	return (0);
+}
+
+int	trace_apply(t_game *game)
+{
+	t_trace	*trace;
+
+	trace = &game->trace;
+	while (trace->next_tick <= game->tick)
+	{
+		if (trace->next_id == TRACE_END)
+			return (1);
+		if (set_movement_flag(&game->input, trace_keycode(trace->next_id),
+				trace->next_pressed))
+			latency_input(&game->latency, now_usec());
+		if (read_next_event(trace))
+			return (1);
+	}
+	return (0);
+}
@@ -0,0 +1,84 @@
+#include "cub3d.h"
+
+void	trace_put(t_trace *trace, const void *src, size_t len)
+{
+	unsigned char	*tmp;
+
+	if (trace->len + len > trace->cap)
+	{
+		trace->cap = (trace->len + len) * 2 + 256;
+		tmp = safe_malloc(trace->cap);
+		if (trace->data)
+			ft_memcpy(tmp, trace->data, trace->len);
+		free(trace->data);
+		trace->data = tmp;
+	}
+	ft_memcpy(trace->data + trace->len, src, len);
+	trace->len += len;
+}
+
+void	trace_put_varint(t_trace *trace, unsigned long value)
+{
+	unsigned char	byte;
+
+	while (value >= 0x80)
+	{
+		byte = (unsigned char)(value | 0x80);
+		trace_put(trace, &byte, 1);
+		value >>= 7;
+	}
+	byte = (unsigned char)value;
+	trace_put(trace, &byte, 1);
+}
+
+int	trace_get_varint(t_trace *trace, unsigned long *value)
+{
+	int	shift;
+
+	*value = 0;
+	shift = 0;
+	while (trace->pos < trace->len && shift < 64)
+	{
+		*value |= (unsigned long)(trace->data[trace->pos] & 0x7F) << shift;
+		if (!(trace->data[trace->pos++] & 0x80))
+			return (0);
+		shift += 7;
+	}
+	return (-1);
+}
+
+int	trace_key_id(int keycode)
+{
+	if (keycode == KEY_W)
+		return (0);
+	if (keycode == KEY_S)
+		return (1);
+	if (keycode == KEY_A)
+		return (2);
+	if (keycode == KEY_D)
+		return (3);
+	if (keycode == KEY_LEFT)
+		return (4);
+	if (keycode == KEY_RIGHT)
+		return (5);
+	if (keycode == KEY_E)
+		return (6);
+	return (-1);
+}
+
+int	trace_keycode(int id)
+{
+	if (id == 0)
+		return (KEY_W);
+	if (id == 1)
+		return (KEY_S);
+	if (id == 2)
+		return (KEY_A);
+	if (id == 3)
+		return (KEY_D);
+	if (id == 4)
+		return (KEY_LEFT);
+	if (id == 5)
+		return (KEY_RIGHT);
+	return (KEY_E);
+}
@@ -0,0 +1,61 @@
+#include "cub3d.h"
+
+static void	step_sessions(void *ctx, int begin, int end)
+{
+	t_runtime	*rt;
+
+	rt = (t_runtime *)ctx;
+	while (begin < end)
+	{
+		session_step(&rt->sessions[begin]);
+		begin++;
+	}
+}
+
+int	runtime_init(t_runtime *rt, t_game *host, int count)
+{
+	ft_bzero(rt, sizeof(t_runtime));
+	rt->host = host;
+	rt->sessions = ft_calloc(count, sizeof(t_session));
+	while (rt->count < count)
+	{
+		if (session_init(&rt->sessions[rt->count], host, rt->count))
+		{
+			runtime_destroy(rt);
+			return (1);
+		}
+		rt->count++;
+	}
+	rt->active = count;
+	return (0);
+}
+
+int	runtime_tick(t_runtime *rt)
+{
+	int	i;
+
+	pool_run(&rt->host->pool, step_sessions, rt, rt->count);
+	rt->active = 0;
+	i = 0;
+	while (i < rt->count)
+	{
+		if (!rt->sessions[i].done)
+			rt->active++;
+		i++;
+	}
+	return (rt->active);
+}
+
+void	runtime_destroy(t_runtime *rt)
+{
+	int	i;
+
+	i = 0;
+	while (i < rt->count)
+	{
+		session_destroy(&rt->sessions[i]);
+		i++;
+	}
+	free(rt->sessions);
+	ft_bzero(rt, sizeof(t_runtime));
+}
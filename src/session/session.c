@@ -0,0 +1,85 @@
+#include "cub3d.h"
+
+static void	session_detach(t_game *game)
+{
+	game->mlx = NULL;
+	game->win = NULL;
+	game->map.shared = 1;
+	game->dda = NULL;
+	game->pmu = NULL;
+	game->reload = NULL;
+	game->flow_count = 0;
+	game->opts.record_path = NULL;
+}
+
+int	session_init(t_session *session, t_game *host, int id)
+{
+	t_game	*game;
+
+	ft_bzero(session, sizeof(t_session));
+	session->id = id;
+	game = &session->game;
+	*game = *host;
+	session_detach(game);
+	ft_bzero(&game->input, sizeof(t_input));
+	ft_bzero(&game->entities, sizeof(t_entities));
+	ft_bzero(&game->pool, sizeof(t_pool));
+	ft_bzero(&game->latency, sizeof(t_latency));
+	ft_bzero(&game->minimap, sizeof(t_minimap));
+	ft_bzero(&game->reproj, sizeof(t_reproj));
+	if (game->trace.mode != TRACE_REPLAY)
+		ft_bzero(&game->trace, sizeof(t_trace));
+	game->tick = 0;
+	game->running = 1;
+	if (view_target_init(game, &game->frame, host->frame.width,
+			host->frame.height))
+		return (1);
+	map_doors_clone(&game->map.doors, &host->map.doors);
+	return (0);
+}
+
+static void	drive_session(t_session *session)
+{
+	t_input	*input;
+	long	phase;
+
+	input = &session->game.input;
+	phase = (session->game.tick + session->id * 37) / 45;
+	input->forward = (phase % 4 != 3);
+	input->turn_left = (phase % 4 == 1);
+	input->turn_right = (phase % 4 == 3);
+}
+
+void	session_step(t_session *session)
+{
+	t_game	*game;
+
+	game = &session->game;
+	if (session->done)
+		return ;
+	if (game->trace.mode == TRACE_REPLAY)
+	{
+		if (trace_apply(game))
+		{
+			session->done = 1;
+			return ;
+		}
+	}
+	else
+		drive_session(session);
+	update_game_state(game);
+	game->tick++;
+	render_frame(game);
+	session->frames++;
+}
+
+void	session_destroy(t_session *session)
+{
+	release_image(&session->game, &session->game.frame);
+	free_entities(&session->game.entities);
+	free_minimap(&session->game.minimap);
+	free_reproj(&session->game);
+	free(session->game.map.doors.items);
+	free(session->game.map.doors.moving);
+	ft_bzero(session, sizeof(t_session));
+}
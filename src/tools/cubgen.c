@@ -0,0 +1,110 @@
+#include "cub3d.h"
+#include <stdio.h>
+
+#define GEN_MAX_SIZE 50000
+#define GEN_TEMPLATE "maps/map1.cub"
+
+static t_gen_row	pick_generator(const char *kind)
+{
+	if (ft_strncmp(kind, "maze", 5) == 0)
+		return (gen_maze_row);
+	if (ft_strncmp(kind, "arena", 6) == 0)
+		return (gen_arena_row);
+	if (ft_strncmp(kind, "corridors", 10) == 0)
+		return (gen_corridor_row);
+	if (ft_strncmp(kind, "caves", 6) == 0)
+		return (gen_cave_row);
+	return (NULL);
+}
+
+static void	place_player(t_gen *gen, t_gen_row row)
+{
+	gen->player_x = 1;
+	gen->player_y = 1;
+	if (row == gen_arena_row || row == gen_cave_row)
+	{
+		gen->player_x = gen->width / 2 - (gen->width / 2) % 8;
+		gen->player_y = gen->height / 2 - (gen->height / 2) % 8;
+		if (gen->player_x < 1)
+			gen->player_x = 1;
+		if (gen->player_y < 1)
+			gen->player_y = 1;
+	}
+}
+
+static int	write_map(t_gen *gen, t_gen_row row)
+{
+	int	y;
+
+	gen->row = safe_malloc(gen->width + 1);
+	gen->row[gen->width] = '\n';
+	if (row == gen_maze_row)
+		gen_maze_init(gen);
+	y = 0;
+	while (y < gen->height)
+	{
+		row(gen, y);
+		if (y == gen->player_y)
+			gen->row[gen->player_x] = 'N';
+		if (write_all(gen->fd, gen->row, gen->width + 1))
+			break ;
+		y++;
+	}
+	gen_maze_free(gen);
+	free(gen->row);
+	return (y < gen->height);
+}
+
+static int	parse_args(t_gen *gen, int argc, char **argv)
+{
+	int	seed;
+
+	ft_bzero(gen, sizeof(t_gen));
+	if (argc < 6 || argc > 7 || ft_atoi_strict(argv[2], &gen->width)
+		|| ft_atoi_strict(argv[3], &gen->height)
+		|| ft_atoi_strict(argv[4], &seed))
+		return (1);
+	if (gen->width < 3 || gen->height < 3 || gen->width > GEN_MAX_SIZE
+		|| gen->height > GEN_MAX_SIZE)
+		return (1);
+	gen->seed = (unsigned int)seed;
+	gen->rng = gen->seed * 2654435761u + 1;
+	return (0);
+}
+
+int	main(int argc, char **argv)
+{
+	t_gen		gen;
+	t_gen_row	row;
+	char		*header;
+	size_t		len;
+	int			status;
+
+	row = NULL;
+	if (argc > 1)
+		row = pick_generator(argv[1]);
+	if (!row || parse_args(&gen, argc, argv))
+	{
+		fprintf(stderr, "Usage: %s <maze|arena|corridors|caves> <width> "
+			"<height> <seed> <out.cub> [template.cub]\n", argv[0]);
+		return (1);
+	}
+	if (argc == 7)
+		header = gen_load_header(argv[6], &len);
+	else
+		header = gen_load_header(GEN_TEMPLATE, &len);
+	if (!header)
+		return (print_error("Unable to read template .cub"));
+	gen.fd = open(argv[5], O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (gen.fd < 0)
+	{
+		free(header);
+		return (print_error("Unable to open output file"));
+	}
+	place_player(&gen, row);
+	status = write_all(gen.fd, header, len) || write_map(&gen, row);
+	free(header);
+	if (close(gen.fd) || status)
+		return (print_error("Failed to write map"));
+	return (0);
+}
@@ -0,0 +1,31 @@
+#include "cub3d.h"
+
+void	*safe_malloc(size_t size)
+{
+	void	*ptr;
+
+	malloc_calls(1);
+	ptr = malloc(size);
+	if (!ptr)
+	{
+		write(2, "Error\nmalloc failed\n", 21);
+		exit(EXIT_FAILURE);
+	}
+	return (ptr);
+}
+
+void	*ft_calloc(size_t count, size_t size)
+{
+	void	*ptr;
+
+	ptr = safe_malloc(count * size);
+	ft_bzero(ptr, count * size);
+	return (ptr);
+}
+
+long	malloc_calls(int add)
+{
+	static long	count;
+
+	return (__atomic_add_fetch(&count, add, __ATOMIC_RELAXED));
+}
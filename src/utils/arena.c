@@ -0,0 +1,66 @@
+#include "cub3d.h"
+
+static t_arena_block	*arena_block(size_t size, t_arena_block *next)
+{
+	t_arena_block	*block;
+
+	if (size < ARENA_BLOCK)
+		size = ARENA_BLOCK;
+	block = safe_malloc(sizeof(t_arena_block) + size);
+	block->next = next;
+	block->cap = size;
+	block->used = 0;
+	return (block);
+}
+
+void	*arena_alloc(t_arena *arena, size_t size)
+{
+	void	*ptr;
+
+	size = (size + 7) & ~(size_t)7;
+	if (!arena->cur)
+	{
+		arena->head = arena_block(size, NULL);
+		arena->cur = arena->head;
+	}
+	else if (arena->cur->used + size > arena->cur->cap)
+	{
+		if (!arena->cur->next || arena->cur->next->cap < size)
+			arena->cur->next = arena_block(size, arena->cur->next);
+		arena->cur = arena->cur->next;
+		arena->cur->used = 0;
+	}
+	ptr = arena->cur->data + arena->cur->used;
+	arena->cur->used += size;
+	return (ptr);
+}
+
+char	*arena_strndup(t_arena *arena, const char *s, size_t n)
+{
+	char	*dup;
+
+	dup = arena_alloc(arena, n + 1);
+	ft_memcpy(dup, s, n);
+	dup[n] = '\0';
+	return (dup);
+}
+
+void	arena_reset(t_arena *arena)
+{
+	arena->cur = arena->head;
+	if (arena->cur)
+		arena->cur->used = 0;
+}
+
+void	arena_free(t_arena *arena)
+{
+	t_arena_block	*next;
+
+	while (arena->head)
+	{
+		next = arena->head->next;
+		free(arena->head);
+		arena->head = next;
+	}
+	arena->cur = NULL;
+}
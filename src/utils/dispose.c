@@ -13,22 +13,35 @@ void	free_config(t_config *cfg)
 		cfg->has_texture[i] = 0;
 		i++;
 	}
+	while (cfg->mat_count > 0)
+	{
+		i = 0;
+		cfg->mat_count--;
+		while (i < TEX_COUNT)
+			free(cfg->mat[cfg->mat_count].face[i++]);
+	}
+	ft_bzero(cfg->mat, sizeof(cfg->mat));
+	ft_bzero(cfg->mat_index, sizeof(cfg->mat_index));
+	ft_bzero(cfg->breakable, sizeof(cfg->breakable));
 	cfg->floor_set = 0;
 	cfg->ceiling_set = 0;
 }
 
 void	free_map(t_map *map)
 {
-	int	i;
+	long	i;
 
 	i = 0;
-	while (map->grid && i < map->height)
+	while (map->chunks && i < (long)map->chunk_cols * map->chunk_rows)
 	{
-		free(map->grid[i]);
+		if (map_chunk_owned(map, map->chunks[i]))
+			free(map->chunks[i]);
 		i++;
 	}
-	free(map->grid);
-	map->grid = NULL;
-	map->height = 0;
-	map->width = 0;
+	free(map->chunks);
+	if (map->store)
+		munmap(map->store, map->store_size);
+	free(map->doors.items);
+	free(map->doors.moving);
+	ft_bzero(map, sizeof(t_map));
 }
@@ -0,0 +1,83 @@
+#include "cub3d.h"
+
+static char	*grow_buffer(char *old, size_t len, size_t *cap)
+{
+	char	*tmp;
+
+	*cap = *cap * 2 + 4096;
+	tmp = safe_malloc(*cap + 1);
+	if (old)
+		ft_memcpy(tmp, old, len);
+	free(old);
+	return (tmp);
+}
+
+static ssize_t	read_all(int fd, char **buf, size_t *len)
+{
+	size_t	cap;
+	ssize_t	bytes;
+
+	cap = 0;
+	bytes = 1;
+	while (bytes > 0)
+	{
+		if (*len == cap)
+			*buf = grow_buffer(*buf, *len, &cap);
+		bytes = read(fd, *buf + *len, cap - *len);
+		if (bytes > 0)
+			*len += bytes;
+	}
+	return (bytes);
+}
+
+char	*read_file(const char *path, size_t *out_len)
+{
+	int		fd;
+	char	*buf;
+	size_t	len;
+	ssize_t	bytes;
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (NULL);
+	buf = NULL;
+	len = 0;
+	bytes = read_all(fd, &buf, &len);
+	close(fd);
+	if (bytes < 0)
+	{
+		free(buf);
+		return (NULL);
+	}
+	buf[len] = '\0';
+	*out_len = len;
+	return (buf);
+}
+
+int	write_all(int fd, const void *data, size_t len)
+{
+	ssize_t	bytes;
+
+	while (len > 0)
+	{
+		bytes = write(fd, data, len);
+		if (bytes <= 0)
+			return (-1);
+		data = (const char *)data + bytes;
+		len -= bytes;
+	}
+	return (0);
+}
+
+int	write_file(const char *path, const void *data, size_t len)
+{
+	int	fd;
+	int	status;
+
+	fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return (-1);
+	status = write_all(fd, data, len);
+	close(fd);
+	return (status);
+}
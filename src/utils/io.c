@@ -1,79 +1,82 @@
 #include "cub3d.h"
 
-static int	append_char(char **line, int len, char c)
+static int	reader_fill(t_reader *rd)
 {
-	char	*tmp;
+	ssize_t	bytes;
 
-	tmp = safe_malloc(len + 2);
-	if (*line)
-	{
-		ft_memcpy(tmp, *line, len);
-		free(*line);
-	}
-	tmp[len] = c;
-	tmp[len + 1] = '\0';
-	*line = tmp;
-	return (1);
+	bytes = read(rd->fd, rd->buf, READ_CHUNK);
+	if (bytes < 0)
+		return (-1);
+	rd->pos = 0;
+	rd->len = bytes;
+	return (bytes > 0);
 }
 
-int	read_line(int fd, char **line)
+static void	reader_keep(t_reader *rd, size_t *len, int end)
 {
-	char	buffer;
-	int		bytes;
-	int		len;
+	size_t	n;
+	char	*tmp;
 
-	if (!line)
-		return (-1);
-	*line = NULL;
-	len = 0;
-	while ((bytes = read(fd, &buffer, 1)) > 0)
+	n = end - rd->pos;
+	if (*len + n + 1 > rd->line_cap)
 	{
-		if (buffer == '\n')
-			break ;
-		if (!append_char(line, len, buffer))
-			return (-1);
-		len++;
+		rd->line_cap = (*len + n + 1) * 2;
+		tmp = safe_malloc(rd->line_cap);
+		ft_memcpy(tmp, rd->line, *len);
+		free(rd->line);
+		rd->line = tmp;
 	}
-	if (bytes < 0)
-		return (-1);
-	if (!*line)
-		*line = ft_strdup("");
-	if (bytes == 0 && len == 0)
-		return (0);
-	return (1);
+	ft_memcpy(rd->line + *len, rd->buf + rd->pos, n);
+	*len += n;
+	rd->line[*len] = '\0';
 }
 
-char	**arr_push(char ***arr, int *len, char *line)
+static int	reader_scan(t_reader *rd, size_t *len, char **line)
 {
-	char	**tmp;
-	int		i;
+	int	end;
 
-	tmp = safe_malloc(sizeof(char *) * (*len + 2));
-	i = 0;
-	while (i < *len)
+	end = rd->pos;
+	while (end < rd->len && rd->buf[end] != '\n')
+		end++;
+	if (end < rd->len && *len == 0)
 	{
-		tmp[i] = (*arr)[i];
-		i++;
+		rd->buf[end] = '\0';
+		*line = rd->buf + rd->pos;
+		rd->pos = end + 1;
+		return (1);
 	}
-	tmp[i] = line;
-	tmp[i + 1] = NULL;
-	free(*arr);
-	*arr = tmp;
-	(*len)++;
-	return (*arr);
+	reader_keep(rd, len, end);
+	rd->pos = end;
+	if (end == rd->len)
+		return (0);
+	rd->pos++;
+	*line = rd->line;
+	return (1);
 }
 
-void	free_str_array(char **arr)
+int	read_line(t_reader *rd, char **line)
 {
-	int	i;
+	size_t	len;
+	int		status;
 
-	if (!arr)
-		return ;
-	i = 0;
-	while (arr[i])
+	if (!line)
+		return (-1);
+	len = 0;
+	while (1)
 	{
-		free(arr[i]);
-		i++;
+		if (rd->pos == rd->len)
+		{
+			status = reader_fill(rd);
+			if (status < 0)
+				return (-1);
+			if (status == 0)
+				break ;
+		}
+		if (reader_scan(rd, &len, line))
+			return (1);
 	}
-	free(arr);
+	*line = rd->line;
+	if (len == 0)
+		return (0);
+	return (1);
 }
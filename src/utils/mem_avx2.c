@@ -0,0 +1,129 @@
+#include "cub3d.h"
+#if defined(__x86_64__) || defined(__i386__)
+# include <immintrin.h>
+
+__attribute__((target("avx2")))
+static void	avx2_copy_body(char *d, const char *s, size_t n)
+{
+	while (n >= 128)
+	{
+		_mm256_storeu_si256((__m256i *)d,
+			_mm256_loadu_si256((const __m256i *)s));
+		_mm256_storeu_si256((__m256i *)d + 1,
+			_mm256_loadu_si256((const __m256i *)s + 1));
+		_mm256_storeu_si256((__m256i *)d + 2,
+			_mm256_loadu_si256((const __m256i *)s + 2));
+		_mm256_storeu_si256((__m256i *)d + 3,
+			_mm256_loadu_si256((const __m256i *)s + 3));
+		d += 128;
+		s += 128;
+		n -= 128;
+	}
+	while (n >= 32)
+	{
+		_mm256_storeu_si256((__m256i *)d,
+			_mm256_loadu_si256((const __m256i *)s));
+		d += 32;
+		s += 32;
+		n -= 32;
+	}
+}
+
+__attribute__((target("avx2")))
+void	mem_avx2_copy(void *dst, const void *src, size_t n)
+{
+	char		*d;
+	const char	*s;
+	__m256i		tail;
+	size_t		skip;
+
+	if (n < 32)
+	{
+		mem_sse2_copy(dst, src, n);
+		return ;
+	}
+	d = (char *)dst;
+	s = (const char *)src;
+	tail = _mm256_loadu_si256((const __m256i *)(s + n - 32));
+	_mm256_storeu_si256((__m256i *)d, _mm256_loadu_si256((const __m256i *)s));
+	skip = 32 - ((size_t)d & 31);
+	avx2_copy_body(d + skip, s + skip, n - skip);
+	_mm256_storeu_si256((__m256i *)(d + n - 32), tail);
+}
+
+__attribute__((target("avx2")))
+static void	avx2_stream32(unsigned int *p, unsigned int value, size_t count)
+{
+	__m256i	v;
+
+	while (((size_t)p & 31) && count > 0)
+	{
+		*p++ = value;
+		count--;
+	}
+	v = _mm256_set1_epi32(value);
+	while (count >= 32)
+	{
+		_mm256_stream_si256((__m256i *)p, v);
+		_mm256_stream_si256((__m256i *)p + 1, v);
+		_mm256_stream_si256((__m256i *)p + 2, v);
+		_mm256_stream_si256((__m256i *)p + 3, v);
+		p += 32;
+		count -= 32;
+	}
+	_mm_sfence();
+	while (count-- > 0)
+		*p++ = value;
+}
+
+__attribute__((target("avx2")))
+static char	*avx2_fill_body(char *d, __m256i v, size_t count)
+{
+	while (count >= 32)
+	{
+		_mm256_storeu_si256((__m256i *)d, v);
+		_mm256_storeu_si256((__m256i *)d + 1, v);
+		_mm256_storeu_si256((__m256i *)d + 2, v);
+		_mm256_storeu_si256((__m256i *)d + 3, v);
+		d += 128;
+		count -= 32;
+	}
+	while (count >= 8)
+	{
+		_mm256_storeu_si256((__m256i *)d, v);
+		d += 32;
+		count -= 8;
+	}
+	return (d);
+}
+
+__attribute__((target("avx2")))
+void	mem_avx2_fill32(void *dst, unsigned int value, size_t count)
+{
+	char	*d;
+	__m256i	v;
+
+	if (count * 4 >= MEM_STREAM_BYTES && !((size_t)dst & 3))
+	{
+		avx2_stream32((unsigned int *)dst, value, count);
+		return ;
+	}
+	if (count < 8)
+	{
+		mem_sse2_fill32(dst, value, count);
+		return ;
+	}
+	d = (char *)dst;
+	v = _mm256_set1_epi32(value);
+	if (!((size_t)d & 3))
+	{
+		_mm256_storeu_si256((__m256i *)d, v);
+		count -= (32 - ((size_t)d & 31)) >> 2;
+		d += 32 - ((size_t)d & 31);
+	}
+	d = avx2_fill_body(d, v, count);
+	count &= 7;
+	if (count > 0)
+		_mm256_storeu_si256((__m256i *)(d + count * 4 - 32), v);
+}
+#endif
@@ -0,0 +1,53 @@
+#include "cub3d.h"
+
+const t_memops	*mem_ops_level(int level)
+{
+	static const t_memops	table[MEM_LEVELS] = {
+	{"word", mem_word_copy, mem_word_fill32},
+	{"sse2", mem_sse2_copy, mem_sse2_fill32},
+	{"avx2", mem_avx2_copy, mem_avx2_fill32}};
+
+	if (level < 0 || level >= MEM_LEVELS)
+		return (NULL);
+#if defined(__x86_64__) || defined(__i386__)
+	if (level == MEM_AVX2 && !__builtin_cpu_supports("avx2"))
+		return (NULL);
+#else
+	if (level != MEM_WORD)
+		return (NULL);
+#endif
+	return (&table[level]);
+}
+
+static const t_memops	*mem_select(void)
+{
+	const char	*env;
+	int			level;
+
+	env = getenv("CUB_MEM");
+	level = MEM_LEVELS;
+	while (--level > MEM_WORD)
+		if (mem_ops_level(level)
+			&& (!env || !ft_strncmp(env, mem_ops_level(level)->name, 5)))
+			return (mem_ops_level(level));
+	return (mem_ops_level(MEM_WORD));
+}
+
+const t_memops	*mem_ops(void)
+{
+	static const t_memops	*ops;
+	const t_memops			*cur;
+
+	cur = __atomic_load_n(&ops, __ATOMIC_ACQUIRE);
+	if (!cur)
+	{
+		cur = mem_select();
+		__atomic_store_n(&ops, cur, __ATOMIC_RELEASE);
+	}
+	return (cur);
+}
+
+void	ft_fill32(void *dst, unsigned int value, size_t count)
+{
+	mem_ops()->fill32(dst, value, count);
+}
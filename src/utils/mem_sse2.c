@@ -0,0 +1,111 @@
+#include "cub3d.h"
+#if defined(__x86_64__) || defined(__i386__)
+# include <immintrin.h>
+
+static void	sse2_copy_body(char *d, const char *s, size_t n)
+{
+	while (n >= 64)
+	{
+		_mm_storeu_si128((__m128i *)d, _mm_loadu_si128((const __m128i *)s));
+		_mm_storeu_si128((__m128i *)d + 1,
+			_mm_loadu_si128((const __m128i *)s + 1));
+		_mm_storeu_si128((__m128i *)d + 2,
+			_mm_loadu_si128((const __m128i *)s + 2));
+		_mm_storeu_si128((__m128i *)d + 3,
+			_mm_loadu_si128((const __m128i *)s + 3));
+		d += 64;
+		s += 64;
+		n -= 64;
+	}
+	while (n >= 16)
+	{
+		_mm_storeu_si128((__m128i *)d, _mm_loadu_si128((const __m128i *)s));
+		d += 16;
+		s += 16;
+		n -= 16;
+	}
+}
+
+void	mem_sse2_copy(void *dst, const void *src, size_t n)
+{
+	char		*d;
+	const char	*s;
+	__m128i		tail;
+	size_t		skip;
+
+	if (n < 16)
+	{
+		mem_word_copy(dst, src, n);
+		return ;
+	}
+	d = (char *)dst;
+	s = (const char *)src;
+	tail = _mm_loadu_si128((const __m128i *)(s + n - 16));
+	_mm_storeu_si128((__m128i *)d, _mm_loadu_si128((const __m128i *)s));
+	skip = 16 - ((size_t)d & 15);
+	sse2_copy_body(d + skip, s + skip, n - skip);
+	_mm_storeu_si128((__m128i *)(d + n - 16), tail);
+}
+
+static void	sse2_stream32(unsigned int *p, unsigned int value, size_t count)
+{
+	__m128i	v;
+
+	while (((size_t)p & 15) && count > 0)
+	{
+		*p++ = value;
+		count--;
+	}
+	v = _mm_set1_epi32(value);
+	while (count >= 16)
+	{
+		_mm_stream_si128((__m128i *)p, v);
+		_mm_stream_si128((__m128i *)p + 1, v);
+		_mm_stream_si128((__m128i *)p + 2, v);
+		_mm_stream_si128((__m128i *)p + 3, v);
+		p += 16;
+		count -= 16;
+	}
+	_mm_sfence();
+	while (count-- > 0)
+		*p++ = value;
+}
+
+static char	*sse2_fill_body(char *d, __m128i v, size_t count)
+{
+	while (count >= 16)
+	{
+		_mm_storeu_si128((__m128i *)d, v);
+		_mm_storeu_si128((__m128i *)d + 1, v);
+		_mm_storeu_si128((__m128i *)d + 2, v);
+		_mm_storeu_si128((__m128i *)d + 3, v);
+		d += 64;
+		count -= 16;
+	}
+	while (count >= 4)
+	{
+		_mm_storeu_si128((__m128i *)d, v);
+		d += 16;
+		count -= 4;
+	}
+	return (d);
+}
+
+void	mem_sse2_fill32(void *dst, unsigned int value, size_t count)
+{
+	char	*d;
+
+	if (count * 4 >= MEM_STREAM_BYTES && !((size_t)dst & 3))
+	{
+		sse2_stream32((unsigned int *)dst, value, count);
+		return ;
+	}
+	d = sse2_fill_body((char *)dst, _mm_set1_epi32(value), count);
+	count &= 3;
+	while (count-- > 0)
+	{
+		*(t_u32u *)d = value;
+		d += 4;
+	}
+}
+#endif
@@ -0,0 +1,55 @@
+#include "cub3d.h"
+
+void	mem_word_copy(void *dst, const void *src, size_t n)
+{
+	unsigned char		*d;
+	const unsigned char	*s;
+
+	d = (unsigned char *)dst;
+	s = (const unsigned char *)src;
+	while (n >= 32)
+	{
+		((t_u64u *)d)[0] = ((const t_u64u *)s)[0];
+		((t_u64u *)d)[1] = ((const t_u64u *)s)[1];
+		((t_u64u *)d)[2] = ((const t_u64u *)s)[2];
+		((t_u64u *)d)[3] = ((const t_u64u *)s)[3];
+		d += 32;
+		s += 32;
+		n -= 32;
+	}
+	while (n >= 8)
+	{
+		*(t_u64u *)d = *(const t_u64u *)s;
+		d += 8;
+		s += 8;
+		n -= 8;
+	}
+	while (n-- > 0)
+		*d++ = *s++;
+}
+
+void	mem_word_fill32(void *dst, unsigned int value, size_t count)
+{
+	unsigned char	*d;
+	unsigned long	wide;
+
+	d = (unsigned char *)dst;
+	wide = (unsigned long)value << 32 | value;
+	while (count >= 8)
+	{
+		((t_u64u *)d)[0] = wide;
+		((t_u64u *)d)[1] = wide;
+		((t_u64u *)d)[2] = wide;
+		((t_u64u *)d)[3] = wide;
+		d += 32;
+		count -= 8;
+	}
+	while (count >= 2)
+	{
+		*(t_u64u *)d = wide;
+		d += 8;
+		count -= 2;
+	}
+	if (count)
+		*(t_u32u *)d = value;
+}
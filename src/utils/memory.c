@@ -2,53 +2,24 @@
 
 void	*ft_memcpy(void *dst, const void *src, size_t n)
 {
-	size_t			i;
-	unsigned char	*d;
-	const unsigned char	*s;
-
-	d = (unsigned char *)dst;
-	s = (const unsigned char *)src;
-	i = 0;
-	while (i < n)
-	{
-		d[i] = s[i];
-		i++;
-	}
+	mem_ops()->copy(dst, src, n);
 	return (dst);
 }
 
-void	ft_bzero(void *ptr, size_t size)
+void	*ft_memset(void *ptr, int c, size_t size)
 {
-	size_t			i;
 	unsigned char	*p;
+	size_t			i;
 
 	p = (unsigned char *)ptr;
-	i = 0;
+	mem_ops()->fill32(p, (unsigned char)c * 0x01010101u, size >> 2);
+	i = size & ~(size_t)3;
 	while (i < size)
-	{
-		p[i] = 0;
-		i++;
-	}
-}
-
-void	*safe_malloc(size_t size)
-{
-	void	*ptr;
-
-	ptr = malloc(size);
-	if (!ptr)
-	{
-		write(2, "Error\nmalloc failed\n", 21);
-		exit(EXIT_FAILURE);
-	}
+		p[i++] = (unsigned char)c;
 	return (ptr);
 }
 
-void	*ft_calloc(size_t count, size_t size)
+void	ft_bzero(void *ptr, size_t size)
 {
-	void	*ptr;
-
-	ptr = safe_malloc(count * size);
-	ft_bzero(ptr, count * size);
-	return (ptr);
+	ft_memset(ptr, 0, size);
 }
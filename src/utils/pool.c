@@ -0,0 +1,112 @@
+#include "cub3d.h"
+
+static void	pool_drain(t_pool *pool)
+{
+	int		begin;
+	int		end;
+	int		timed;
+	long	start;
+
+	timed = pool->timed;
+	while (1)
+	{
+		begin = __atomic_fetch_add(&pool->next, pool->grain, __ATOMIC_ACQ_REL);
+		if (begin >= pool->count)
+			return ;
+		end = begin + pool->grain;
+		if (end > pool->count)
+			end = pool->count;
+		if (timed)
+			start = now_usec();
+		pool->job(pool->ctx, begin, end);
+		if (timed)
+			__atomic_fetch_add(&pool->work_us, now_usec() - start,
+				__ATOMIC_RELAXED);
+		__atomic_fetch_sub(&pool->pending, end - begin, __ATOMIC_ACQ_REL);
+	}
+}
+
+static void	*pool_worker(void *param)
+{
+	t_pool			*pool;
+	unsigned long	seen;
+
+	pool = (t_pool *)param;
+	seen = 0;
+	pthread_mutex_lock(&pool->lock);
+	while (!pool->stop)
+	{
+		while (!pool->stop && pool->generation == seen)
+			pthread_cond_wait(&pool->wake, &pool->lock);
+		if (pool->stop)
+			break ;
+		seen = pool->generation;
+		pool->busy++;
+		pthread_mutex_unlock(&pool->lock);
+		pool_drain(pool);
+		pthread_mutex_lock(&pool->lock);
+		pool->busy--;
+		pthread_cond_broadcast(&pool->done);
+	}
+	pthread_mutex_unlock(&pool->lock);
+	return (NULL);
+}
+
+int	pool_init(t_pool *pool, int threads)
+{
+	ft_bzero(pool, sizeof(t_pool));
+	if (threads <= 0)
+		threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if (threads < 1)
+		threads = 1;
+	pool->size = threads;
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->wake, NULL);
+	pthread_cond_init(&pool->done, NULL);
+	pool->threads = ft_calloc(threads, sizeof(pthread_t));
+	while (pool->spawned < threads - 1)
+	{
+		if (pthread_create(&pool->threads[pool->spawned], NULL,
+				pool_worker, pool))
+			break ;
+		pool->spawned++;
+	}
+	return (0);
+}
+
+static void	pool_post(t_pool *pool, t_job job, void *ctx, int count)
+{
+	pool->job = job;
+	pool->ctx = ctx;
+	pool->count = count;
+	pool->grain = count;
+	if (pool->spawned > 0)
+		pool->grain = count / (pool->size * 8) + 1;
+	pool->pending = count;
+	__atomic_store_n(&pool->next, 0, __ATOMIC_RELEASE);
+}
+
+void	pool_run(t_pool *pool, t_job job, void *ctx, int count)
+{
+	if (count > 0 && !pool)
+		job(ctx, 0, count);
+	if (count <= 0 || !pool)
+		return ;
+	if (pool->spawned == 0)
+	{
+		pool_post(pool, job, ctx, count);
+		pool_drain(pool);
+		return ;
+	}
+	pthread_mutex_lock(&pool->lock);
+	pool_post(pool, job, ctx, count);
+	pool->generation++;
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+	pool_drain(pool);
+	pthread_mutex_lock(&pool->lock);
+	while (__atomic_load_n(&pool->pending, __ATOMIC_ACQUIRE) != 0
+		|| pool->busy > 0)
+		pthread_cond_wait(&pool->done, &pool->lock);
+	pthread_mutex_unlock(&pool->lock);
+}
@@ -0,0 +1,24 @@
+#include "cub3d.h"
+
+void	pool_destroy(t_pool *pool)
+{
+	int	i;
+
+	if (!pool->threads)
+		return ;
+	pthread_mutex_lock(&pool->lock);
+	pool->stop = 1;
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+	i = 0;
+	while (i < pool->spawned)
+	{
+		pthread_join(pool->threads[i], NULL);
+		i++;
+	}
+	free(pool->threads);
+	pthread_mutex_destroy(&pool->lock);
+	pthread_cond_destroy(&pool->wake);
+	pthread_cond_destroy(&pool->done);
+	ft_bzero(pool, sizeof(t_pool));
+}
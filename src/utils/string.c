@@ -116,7 +116,7 @@ char	*trim_spaces(char *str)
 	return (str);
 }
 
-int	is_map_line(const char *line)
+int	is_map_line(const char *line, const t_config *cfg)
 {
 	int	i;
 	int	has_map_char;
@@ -127,7 +127,7 @@ int	is_map_line(const char *line)
 		return (0);
 	while (line[i])
 	{
-		if (line[i] == '0' || line[i] == '1')
+		if (line[i] == '0' || scene_wall_code(cfg, line[i]))
 			has_map_char = 1;
 		else if (line[i] == 'N' || line[i] == 'S'
 			|| line[i] == 'E' || line[i] == 'W')
@@ -0,0 +1,472 @@
+#include "cub3d.h"
+#include <stdio.h>
+#include <string.h>
+
+#define VIEWS_PER_MAP 4
+#define MULTI_VIEWS 3
+#define MINIMAP_TICKS 90
+#define SPAN_CHECK_TICKS 6
+#define TIMING_RUNS 15
+#define TIMING_RETRIES 3
+#define SESSION_COUNT 4
+#define SESSION_TICKS 60
+#define SESSION_TRACE "build/regress_session.trace"
+#define MAX_CASES 1024
+
+typedef struct s_case
+{
+	char			map[256];
+	int				view;
+	char			hash[32];
+	double			ms;
+}	t_case;
+
+typedef struct s_suite
+{
+	t_case	golden[MAX_CASES];
+	int		golden_count;
+	t_case	result[MAX_CASES];
+	int		result_count;
+	double	tolerance;
+	int		update;
+	int		failures;
+}	t_suite;
+
+static void	load_golden(t_suite *suite, const char *path)
+{
+	FILE	*file;
+	char	line[512];
+	t_case	*c;
+
+	file = fopen(path, "r");
+	if (!file)
+		return ;
+	while (fgets(line, sizeof(line), file) && suite->golden_count < MAX_CASES)
+	{
+		if (line[0] == '#')
+			continue ;
+		c = &suite->golden[suite->golden_count];
+		if (sscanf(line, "%255s %d %31s %lf", c->map, &c->view, c->hash,
+				&c->ms) == 4)
+			suite->golden_count++;
+	}
+	fclose(file);
+}
+
+static t_case	*find_golden(t_suite *suite, const char *map, int view)
+{
+	int	i;
+
+	for (i = 0; i < suite->golden_count; i++)
+		if (!strcmp(suite->golden[i].map, map) && suite->golden[i].view == view)
+			return (&suite->golden[i]);
+	return (NULL);
+}
+
+static void	set_view(t_player *player, const t_player *spawn, int view)
+{
+	double	tmp;
+	int		i;
+
+	*player = *spawn;
+	for (i = 0; i < view; i++)
+	{
+		tmp = player->dir_x;
+		player->dir_x = -player->dir_y;
+		player->dir_y = tmp;
+		tmp = player->plane_x;
+		player->plane_x = -player->plane_y;
+		player->plane_y = tmp;
+	}
+}
+
+static unsigned long	frame_hash(t_img *img)
+{
+	unsigned long	hash;
+	int				x;
+	int				y;
+
+	hash = 1469598103934665603UL;
+	for (y = 0; y < img->height; y++)
+	{
+		for (x = 0; x < img->width * 4; x++)
+		{
+			hash ^= (unsigned char)img->addr[(long)y * img->line_len + x];
+			hash *= 1099511628211UL;
+		}
+	}
+	return (hash);
+}
+
+static int	is_slower(t_suite *suite, t_case *res)
+{
+	t_case	*ref;
+
+	ref = find_golden(suite, res->map, res->view);
+	return (!suite->update && ref && suite->tolerance > 0 && ref->ms > 0
+		&& res->ms > ref->ms * suite->tolerance + 0.5);
+}
+
+static void	check_case(t_suite *suite, t_case *res)
+{
+	t_case		*ref;
+	const char	*status;
+	int			slower;
+
+	ref = find_golden(suite, res->map, res->view);
+	slower = is_slower(suite, res);
+	status = "PASS";
+	if (suite->update)
+		status = "UPDATED";
+	else if (!ref)
+		status = "MISSING";
+	else if (strcmp(ref->hash, res->hash))
+		status = "FAIL pixels";
+	else if (slower)
+		status = "FAIL slower";
+	if (strcmp(status, "PASS") && strcmp(status, "UPDATED"))
+		suite->failures++;
+	printf("%-12s %-28s view %d  %-16s %8.3f ms", status, res->map,
+		res->view, res->hash, res->ms);
+	if (ref && !suite->update)
+		printf("  (baseline %.3f ms)", ref->ms);
+	printf("\n");
+}
+
+static int	spans_match(t_game *game)
+{
+	t_img			frame;
+	t_view			view;
+	unsigned long	hash;
+
+	view_target_init(game, &frame, game->frame.width, game->frame.height);
+	view.cam = game->player;
+	view.target = &frame;
+	view.steps = 0;
+	view.stats = NULL;
+	render_view(game, &view);
+	hash = frame_hash(&frame);
+	game->opts.no_spans = 1;
+	render_view(game, &view);
+	game->opts.no_spans = 0;
+	hash ^= frame_hash(&frame);
+	release_image(game, &frame);
+	return (hash == 0);
+}
+
+static int	reproject_match(t_game *game)
+{
+	unsigned long	hash;
+
+	hash = frame_hash(&game->frame);
+	game->opts.reproject = 1;
+	render_frame(game);
+	render_frame(game);
+	hash ^= frame_hash(&game->frame);
+	if (game->reproj.full != 1)
+		hash |= 1;
+	free_reproj(game);
+	game->opts.reproject = 0;
+	return (hash == 0);
+}
+
+static double	time_frame(t_game *game)
+{
+	long	start;
+	long	best;
+	int		run;
+
+	best = -1;
+	for (run = 0; run < TIMING_RUNS; run++)
+	{
+		start = now_usec();
+		render_frame(game);
+		start = now_usec() - start;
+		if (best < 0 || start < best)
+			best = start;
+	}
+	return (best / 1000.0);
+}
+
+static void	render_case(t_suite *suite, t_game *game, t_player *spawn,
+			int view)
+{
+	t_case	*res;
+	int		retry;
+
+	res = &suite->result[suite->result_count++];
+	snprintf(res->map, sizeof(res->map), "%s", game->opts.map_path);
+	res->view = view;
+	set_view(&game->player, spawn, view);
+	res->ms = time_frame(game);
+	for (retry = 0; retry < TIMING_RETRIES && is_slower(suite, res); retry++)
+		res->ms = fmin(res->ms, time_frame(game));
+	snprintf(res->hash, sizeof(res->hash), "%016lx", frame_hash(&game->frame));
+	if (!spans_match(game) || !reproject_match(game))
+		snprintf(res->hash, sizeof(res->hash), "MISMATCH");
+	check_case(suite, res);
+}
+
+static unsigned long	multi_hash(t_view *views, int count)
+{
+	unsigned long	hash;
+	int				i;
+
+	hash = 0;
+	for (i = 0; i < count; i++)
+		hash = hash * 31 + frame_hash(views[i].target);
+	return (hash);
+}
+
+static void	multi_case(t_suite *suite, t_game *game, t_player *spawn)
+{
+	static const int	sizes[MULTI_VIEWS][2] = {{640, 360}, {333, 200},
+		{1024, 768}};
+	static const double	planes[MULTI_VIEWS] = {0.66, 1.0, 0.4};
+	t_img				targets[MULTI_VIEWS];
+	t_view				views[MULTI_VIEWS];
+	t_case				*res;
+	unsigned long		together;
+	long				start;
+	int					i;
+
+	res = &suite->result[suite->result_count++];
+	snprintf(res->map, sizeof(res->map), "%s", game->opts.map_path);
+	res->view = VIEWS_PER_MAP;
+	for (i = 0; i < MULTI_VIEWS; i++)
+	{
+		view_target_init(game, &targets[i], sizes[i][0], sizes[i][1]);
+		set_view(&views[i].cam, spawn, i);
+		camera_set_plane(&views[i].cam, planes[i]);
+		views[i].target = &targets[i];
+		views[i].steps = 0;
+		views[i].stats = NULL;
+	}
+	res->ms = -1;
+	for (i = 0; i < TIMING_RUNS; i++)
+	{
+		start = now_usec();
+		render_views(game, views, MULTI_VIEWS);
+		start = now_usec() - start;
+		if (res->ms < 0 || start / 1000.0 < res->ms)
+			res->ms = start / 1000.0;
+	}
+	together = multi_hash(views, MULTI_VIEWS);
+	for (i = 0; i < MULTI_VIEWS; i++)
+		render_view(game, &views[i]);
+	snprintf(res->hash, sizeof(res->hash), "%016lx", together);
+	if (multi_hash(views, MULTI_VIEWS) != together)
+		snprintf(res->hash, sizeof(res->hash), "MISMATCH");
+	for (i = 0; i < MULTI_VIEWS; i++)
+		release_image(game, &targets[i]);
+	check_case(suite, res);
+}
+
+static void	minimap_case(t_suite *suite, t_game *game, t_player *spawn)
+{
+	t_case			*res;
+	unsigned long	patched;
+	long			start;
+	int				spans;
+	int				tick;
+
+	res = &suite->result[suite->result_count++];
+	snprintf(res->map, sizeof(res->map), "%s", game->opts.map_path);
+	res->view = VIEWS_PER_MAP + 1;
+	game->player = *spawn;
+	game->minimap.visible = 1;
+	res->ms = 0;
+	spans = 1;
+	for (tick = 0; tick < MINIMAP_TICKS; tick++)
+	{
+		start = now_usec();
+		game->input.forward = (tick / 30) % 3 != 2;
+		game->input.turn_left = (tick / 30) % 3 == 2;
+		game->input.use = (tick % 15 == 0);
+		update_game_state(game);
+		render_frame(game);
+		res->ms += (now_usec() - start) / 1000.0;
+		if (tick % SPAN_CHECK_TICKS == 0 && !spans_match(game))
+			spans = 0;
+	}
+	patched = frame_hash(&game->minimap.img);
+	minimap_invalidate(game);
+	render_frame(game);
+	snprintf(res->hash, sizeof(res->hash), "%016lx", frame_hash(&game->frame));
+	if (frame_hash(&game->minimap.img) != patched || !spans)
+		snprintf(res->hash, sizeof(res->hash), "MISMATCH");
+	check_case(suite, res);
+}
+
+static int	door_start(t_game *game, const t_player *spawn, t_player *start)
+{
+	int	x;
+	int	y;
+	int	view;
+
+	for (y = 1; y + 1 < game->map.height; y++)
+		for (x = 0; x < game->map.width; x++)
+			if (map_cell(&game->map, x, y) == DOOR_CELL
+				&& map_cell(&game->map, x, y - 1) == '0'
+				&& map_cell(&game->map, x, y + 1) == '0')
+			{
+				for (view = 0; view < 4; view++)
+				{
+					set_view(start, spawn, view);
+					if (start->dir_y > 0.5)
+						break ;
+				}
+				start->x = x + 0.5;
+				start->y = y - 0.5;
+				return (y);
+			}
+	return (0);
+}
+
+static int	record_door_trace(t_game *game, const t_player *start)
+{
+	game->player = *start;
+	game->tick = 0;
+	trace_start_record(game, SESSION_TRACE);
+	trace_record_key(game, KEY_E, 1);
+	game->tick = 1;
+	trace_record_key(game, KEY_E, 0);
+	trace_record_key(game, KEY_W, 1);
+	game->tick = SESSION_TICKS;
+	if (trace_finish(game))
+		return (1);
+	game->tick = 0;
+	return (trace_load(game, SESSION_TRACE));
+}
+
+static unsigned long	session_run(t_game *host, int count, double *y)
+{
+	t_runtime		rt;
+	unsigned long	hash;
+	int				i;
+
+	if (runtime_init(&rt, host, count))
+		return (0);
+	while (runtime_tick(&rt) > 0)
+		;
+	hash = frame_hash(&rt.sessions[0].game.frame);
+	*y = rt.sessions[0].game.player.y;
+	for (i = 1; i < rt.count; i++)
+		if (frame_hash(&rt.sessions[i].game.frame) != hash
+			|| rt.sessions[i].game.player.y != *y)
+			hash = 0;
+	runtime_destroy(&rt);
+	return (hash);
+}
+
+static void	session_case(t_suite *suite, t_game *game, t_player *spawn)
+{
+	t_case			*res;
+	t_player		start;
+	unsigned long	lone;
+	double			y[2];
+	int				door_y;
+
+	door_y = door_start(game, spawn, &start);
+	if (!door_y)
+		return ;
+	res = &suite->result[suite->result_count++];
+	snprintf(res->map, sizeof(res->map), "%s", game->opts.map_path);
+	res->view = VIEWS_PER_MAP + 2;
+	snprintf(res->hash, sizeof(res->hash), "MISMATCH");
+	res->ms = 0;
+	if (record_door_trace(game, &start) == 0)
+	{
+		lone = session_run(game, 1, &y[0]);
+		res->ms = now_usec();
+		if (lone && session_run(game, SESSION_COUNT, &y[1]) == lone
+			&& y[0] == y[1] && y[0] > door_y + 1.0
+			&& map_door_blocks(&game->map, start.x, door_y))
+			snprintf(res->hash, sizeof(res->hash), "%016lx", lone);
+		res->ms = (now_usec() - res->ms) / 1000.0;
+	}
+	trace_finish(game);
+	remove(SESSION_TRACE);
+	game->player = *spawn;
+	check_case(suite, res);
+}
+
+static void	run_map(t_suite *suite, const char *path)
+{
+	t_game		game;
+	t_player	spawn;
+	int			view;
+	t_case		*res;
+
+	ft_bzero(&game, sizeof(game));
+	game.opts.map_path = path;
+	game.opts.headless = 1;
+	if (parse_scene(&game, path) || init_game(&game))
+	{
+		res = &suite->result[suite->result_count++];
+		snprintf(res->map, sizeof(res->map), "%s", path);
+		res->view = 0;
+		snprintf(res->hash, sizeof(res->hash), "INVALID");
+		res->ms = 0;
+		check_case(suite, res);
+		destroy_game(&game);
+		return ;
+	}
+	spawn = game.player;
+	for (view = 0; view < VIEWS_PER_MAP; view++)
+		render_case(suite, &game, &spawn, view);
+	multi_case(suite, &game, &spawn);
+	session_case(suite, &game, &spawn);
+	minimap_case(suite, &game, &spawn);
+	destroy_game(&game);
+}
+
+static void	write_golden(t_suite *suite, const char *path)
+{
+	FILE	*file;
+	int		i;
+
+	file = fopen(path, "w");
+	if (!file)
+	{
+		perror(path);
+		suite->failures++;
+		return ;
+	}
+	fprintf(file, "# map view framebuffer-fnv1a64 render-ms\n");
+	for (i = 0; i < suite->result_count; i++)
+		fprintf(file, "%s %d %s %.3f\n", suite->result[i].map,
+			suite->result[i].view, suite->result[i].hash,
+			suite->result[i].ms);
+	fclose(file);
+}
+
+int	main(int argc, char **argv)
+{
+	static t_suite	suite;
+	const char		*golden;
+	int				i;
+
+	if (argc < 3)
+	{
+		printf("Usage: %s <golden.txt> [--update] [--tolerance X] "
+			"<map.cub>...\n", argv[0]);
+		return (1);
+	}
+	golden = argv[1];
+	load_golden(&suite, golden);
+	suite.tolerance = 1.5;
+	for (i = 2; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "--update"))
+			suite.update = 1;
+		else if (!strcmp(argv[i], "--tolerance") && i + 1 < argc)
+			suite.tolerance = atof(argv[++i]);
+		else
+			run_map(&suite, argv[i]);
+	}
+	if (suite.update)
+		write_golden(&suite, golden);
+	printf("%d case(s), %d failure(s)\n", suite.result_count, suite.failures);
+	return (suite.failures != 0);
+}